@@ -0,0 +1,43 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+// 运行时检测 CPU 的 SIMD 特性，各处的向量快速路径（跳过自环、换行表、UTF-8 校验等）都按这里的结果分派
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPU_FEATURES_X86 1
+#endif
+
+struct CpuFeatures
+{
+    bool sse2;
+    bool ssse3;
+    bool avx2;
+};
+
+// 第一次调用时检测，之后直接返回缓存的结果
+inline const CpuFeatures &cpu_features()
+{
+    static const CpuFeatures f = []
+    {
+        CpuFeatures c = {false, false, false};
+#ifdef CPU_FEATURES_X86
+        __builtin_cpu_init();
+        c.sse2 = __builtin_cpu_supports("sse2");
+        c.ssse3 = __builtin_cpu_supports("ssse3");
+        c.avx2 = __builtin_cpu_supports("avx2");
+#endif
+        return c;
+    }();
+    return f;
+}
+
+// 0: 标量，1: 128 位（SSE2，need_ssse3 时要求 SSSE3），2: AVX2
+inline int cpu_simd_level(bool need_ssse3 = false)
+{
+    const CpuFeatures &c = cpu_features();
+    if (c.avx2)
+        return 2;
+    if (need_ssse3 ? c.ssse3 : c.sse2)
+        return 1;
+    return 0;
+}
+#endif
@@ -9,6 +9,7 @@
 #include <stack>
 #include <utility>
 #include "../Visualizer.h"
+#include "../LineMap.h"
 
 using namespace std;
 
@@ -235,8 +236,8 @@ void init()
     p["w"] = "while";
 }
 
-int line;              // 当前行号，用于错误报告
-int lastTokenLine = 1; // 上一个成功匹配的 Token 所在的行号
+LineMap lines;        // 输入的行号表：扫描时不再逐个换行计数，只在报错时按位置换算行号
+int lastTokenPos = 0; // 上一个成功匹配的 Token 所在的位置
 
 // 全局推导序列，用于后续可视化输出
 vector<pair<string, int>> llDerivationSeq;
@@ -248,22 +249,8 @@ int solve(string s, int &cur, int l, int d)
     int i = l;
 
     // 跳过空白字符和换行符
-    while (1)
-    {
-        if (s[i] == '\n')
-        {
-            line++;
-            i++;
-        }
-        else if (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
-        {
-            i++;
-        }
-        else
-        {
-            break;
-        }
-    }
+    while (s[i] == ' ' || s[i] == '\n' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
+        i++;
 
     // 获取向前看符号
     string x = "";
@@ -342,22 +329,8 @@ int solve(string s, int &cur, int l, int d)
             for (int k = 0; k < mappedName.length(); k++)
             {
                 // 跳过空白字符
-                while (1)
-                {
-                    if (s[i] == '\n')
-                    {
-                        line++;
-                        i++;
-                    }
-                    else if (s[i] == ' ' || s[i] == '\n' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
-                    {
-                        i++;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
+                while (s[i] == ' ' || s[i] == '\n' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
+                    i++;
 
                 // 检查当前字符是否匹配
                 if (s[i] != mappedName[k])
@@ -383,22 +356,8 @@ int error(string s, int &cur, int l, int d)
     int i = l;
 
     // 跳过空白字符
-    while (1)
-    {
-        if (s[i] == '\n')
-        {
-            line++;
-            i++;
-        }
-        else if (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
-        {
-            i++;
-        }
-        else
-        {
-            break;
-        }
-    }
+    while (s[i] == ' ' || s[i] == '\n' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
+        i++;
 
     // 获取向前看符号
     string x = "";
@@ -423,11 +382,7 @@ int error(string s, int &cur, int l, int d)
         // 恐慌模式：丢弃输入直到并包括同步符号，避免在同一位置反复报错
         while (i < len &&
                s[i] != ';' && s[i] != '}' && s[i] != ')')
-        {
-            if (s[i] == '\n')
-                line++;
             i++;
-        }
         // 吸收一个同步符号（如果存在），防止下一轮又停在同一位置
         if (i < len)
             i++;
@@ -463,36 +418,22 @@ int error(string s, int &cur, int l, int d)
 
             // 匹配终结符
             int flag = 0;
-            int reportLine = line; // 用于记录报错行号
+            int reportLine = 0; // 用于记录报错行号
 
             for (int k = 0; k < mappedName.length(); k++)
             {
-                int startLine = line; // 记录本次字符匹配跳过空白前的行号
-
                 // 跳过空白字符
-                while (1)
-                {
-                    if (s[i] == '\n')
-                    {
-                        line++;
-                        i++;
-                    }
-                    else if (s[i] == ' ' || s[i] == '\n' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
-                    {
-                        i++;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
+                while (s[i] == ' ' || s[i] == '\n' || s[i] == '\t' || s[i] == '\r' || s[i] == '\v')
+                    i++;
 
                 // 检查是否匹配
                 if (s[i] != mappedName[k])
                 {
                     flag = 1;
-                    // 使用 lastTokenLine 来确定报错行号
+                    // 使用上一个成功匹配的 Token 的行号来确定报错行号
                     // 如果当前行号大于上一个成功匹配的 Token 行号，说明错误可能发生在上一行末尾
+                    int line = lines.line(i);
+                    int lastTokenLine = lines.line(lastTokenPos);
                     if (line > lastTokenLine)
                     {
                         reportLine = lastTokenLine;
@@ -505,9 +446,8 @@ int error(string s, int &cur, int l, int d)
                 }
                 else
                 {
-                    // 匹配成功，更新 lastTokenLine
-                    // 注意：这里 line 已经是当前字符所在的行号了
-                    lastTokenLine = line;
+                    // 匹配成功，只记下位置，行号等报错时再换算
+                    lastTokenPos = i;
                 }
                 i++;
             }
@@ -539,12 +479,12 @@ void Analysis(istream &in = cin)
 
     int len = prog.length();
     int cur = cal("A"); // 起始符号A
-    line = 1;
+    lines.build(prog.data(), prog.size());
 
     // 第一遍：检查语法错误
     if (len > 0)
     {
-        lastTokenLine = 1;
+        lastTokenPos = 0;
         error(prog, cur, 0, 1);
     }
 
@@ -556,7 +496,7 @@ void Analysis(istream &in = cin)
     cur = cal("A");            // 重置为起始符号
     if (len > 0)
     {
-        lastTokenLine = 1;
+        lastTokenPos = 0;
         solve(prog, cur, 0, 1);
     }
 
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <algorithm>
 #include "../Visualizer.h"
+#include "../LineMap.h"
 #include "LRTable.h" // 包含自动生成的Action/Goto表
 
 using namespace std;
@@ -38,12 +39,12 @@ struct ParserData
     map<string, char> tokenToChar;   // 词法记号名 → LR 表中使用的单字符编码，例如 "if" -> 'y'
     map<char, string> charToToken;   // 单字符编码 → 可读记号名，例如 'y' -> "if"
     vector<TokenInfo> derivationSeq; // 展平后的推导序列（用于可视化）
-    int lineNum = 0;                 // 当前行号（错误报告用）
+    LineMap lines;                   // 输入的行号表，报错时按当前位置换算行号（错误报告用）
 };
 
 // 函数声明
 void initMappings(ParserData &data);
-int skipWhiteSpaces(const string &source, int pos, int &lineNum);
+int skipWhiteSpaces(const string &source, int pos);
 char getNextTokenChar(const string &source, int pos, ParserData &data);
 void flattenAST(ASTNode *root, int depth, vector<TokenInfo> &seq);
 
@@ -98,28 +99,16 @@ void initMappings(ParserData &data)
     data.charToToken['N'] = "boolop";
 }
 
-/* 跳过空白字符，更新行号，返回下一个非空白字符的位置 */
-int skipWhiteSpaces(const string &source, int pos, int &lineNum)
+/* 跳过空白字符，返回下一个非空白字符的位置；行号由 LineMap 按位置换算，这里不再计数 */
+int skipWhiteSpaces(const string &source, int pos)
 {
     int i = pos;
     int len = source.length();
 
-    while (i < len)
+    while (i < len && (source[i] == ' ' || source[i] == '\n' || source[i] == '\t' ||
+                       source[i] == '\r' || source[i] == '\v'))
     {
-        if (source[i] == '\n')
-        {
-            lineNum++;
-            i++;
-        }
-        else if (source[i] == ' ' || source[i] == '\t' ||
-                 source[i] == '\r' || source[i] == '\v')
-        {
-            i++;
-        }
-        else
-        {
-            break;
-        }
+        i++;
     }
     return i;
 }
@@ -280,7 +269,7 @@ void Analysis(istream &in = cin)
     initLRTable();
     ParserData data;
     initMappings(data);
-    data.lineNum = 1;
+    data.lines.build(prog.data(), prog.size());
 
     stack<int> stateStack; // 状态栈
     stateStack.push(0);
@@ -292,13 +281,12 @@ void Analysis(istream &in = cin)
     bool accepted = false; // 标记是否成功接受输入
 
     char virtualToken = 0;         // 虚拟插入的符号（0 表示无）
-    int lastAcceptedTokenLine = 1; // 上一个成功移进的 Token 所在的行号
+    int lastAcceptedTokenPos = 0;  // 上一个成功移进的 Token 所在的位置，报错时才换算为行号
 
     while (true)
     {
         // 先跳过空白，得到当前向前看符号
-        int prevLine = data.lineNum; // 记录跳过空白前的行号
-        pos = skipWhiteSpaces(prog, pos, data.lineNum);
+        pos = skipWhiteSpaces(prog, pos);
         char lookahead;
         if (virtualToken != 0)
         {
@@ -324,7 +312,9 @@ void Analysis(istream &in = cin)
                 {
                     Action recAct = ACTION[currentState][(unsigned char)c];
 
-                    int reportLine = (data.lineNum > lastAcceptedTokenLine) ? lastAcceptedTokenLine : data.lineNum;
+                    int lineNum = data.lines.line(pos); // 向前看符号所在的行号
+                    int lastAcceptedTokenLine = data.lines.line(lastAcceptedTokenPos);
+                    int reportLine = (lineNum > lastAcceptedTokenLine) ? lastAcceptedTokenLine : lineNum;
                     cout << "语法错误，第" << reportLine << "行，缺少符号: '" << c << "'" << endl;
                     act = recAct;
                     virtualToken = c; // 设置虚拟符号
@@ -337,7 +327,7 @@ void Analysis(istream &in = cin)
             if (!recovered)
             {
                 // 恐慌模式：跳过当前非法符号
-                cout << "语法错误，第" << data.lineNum << "行，遇到非法符号: " << lookahead << " (跳过)" << endl;
+                cout << "语法错误，第" << data.lines.line(pos) << "行，遇到非法符号: " << lookahead << " (跳过)" << endl;
                 pos = consumeToken(prog, pos);
                 continue;
             }
@@ -365,14 +355,14 @@ void Analysis(istream &in = cin)
             {
                 virtualToken = 0; // 虚拟符号已被移进消费
                 // 虚拟符号虽然没有实际对应的 Token，但逻辑上它属于当前上下文
-                // 我们可以选择更新 lastAcceptedTokenLine，也可以不更新
+                // 我们可以选择更新 lastAcceptedTokenPos，也可以不更新
                 // 这里选择不更新，因为它不是输入文件中的真实行
             }
             else
             {
                 // 成功移进真实 Token，更新行号
-                // 注意：data.lineNum 是 lookahead 的行号（即当前移进 Token 的行号）
-                lastAcceptedTokenLine = data.lineNum;
+                // 注意：pos 是 lookahead 的位置（即当前移进 Token 的位置）
+                lastAcceptedTokenPos = pos;
                 pos = consumeToken(prog, pos); // 消费一个输入记号
             }
         }
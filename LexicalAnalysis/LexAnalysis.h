@@ -1,86 +1,60 @@
 // C语言词法分析器
+#ifndef LEX_ANALYSIS_H
+#define LEX_ANALYSIS_H
 #include <cstdio>
 #include <cstring>
 #include <iostream>
-#include <map>
 #include <string>
+#include <string_view>
 #include <fstream>
 #include <sstream>
 #include <vector>
+#include <cstdint>
+#include "LexTable.h"
+#include "LexSimd.h"
+#include "TokenWriter.h"
+#include "../SymbolPool.h"
+#include "../NumberLiteral.h"
 using namespace std;
-/* 标准输入函数 - 改为支持流输入 */
+/* 标准输入函数 - 改为支持流输入，整块读入 */
 void read_prog(string &prog, istream &in)
 {
-    char c;
-    while (in.get(c))
+    ostringstream ss;
+    ss << in.rdbuf();
+    prog += ss.str();
+}
+
+/* 你可以添加其他函数 */
+// 关键字、运算符与界符的种别码由 maker.cpp 从 c_keys.txt 生成并编入 DFA 的接收态（LEX_CODE），
+// 匹配结束即得到种别码，不再查关键字表与运算符表
+
+// 命令行程序的标准输出与已输出的记号数；Lexer 本身不读写这两个变量，只有 scan() 等整程序入口使用
+long long tokenCount = 0; // 超大输入的记号数可能超过 int 范围
+TokenWriter tokenOut(1);
+
+// 输出 token 的函数：写入 out，count 为已输出的记号数（序号从 count + 1 开始）；格式见 TokenWriter::tsv()
+void printToken(TokenWriter &out, long long &count, string_view name, int code)
+{
+    count++;
+    if (out.tsv())
     {
-        prog += c;
+        out.put_uint(code);
+        out.put('\t');
+        out.put(name);
+        out.put('\n');
+        return;
     }
+    out.put_uint(count);
+    out.put(": <");
+    out.put(name);
+    out.put(',');
+    out.put_uint(code);
+    out.put(">\n");
 }
 
-/* 你可以添加其他函数 */
-// 定义关键字映射表
-map<string, int> keywords = {
-    {"auto", 1}, {"break", 2}, {"case", 3}, {"char", 4}, {"const", 5}, {"continue", 6}, {"default", 7}, {"do", 8}, {"double", 9}, {"else", 10}, {"enum", 11}, {"extern", 12}, {"float", 13}, {"for", 14}, {"goto", 15}, {"if", 16}, {"int", 17}, {"long", 18}, {"register", 19}, {"return", 20}, {"short", 21}, {"signed", 22}, {"sizeof", 23}, {"static", 24}, {"struct", 25}, {"switch", 26}, {"typedef", 27}, {"union", 28}, {"unsigned", 29}, {"void", 30}, {"volatile", 31}, {"while", 32}};
-
-// 定义运算符和界符映射表 按c_keys.txt文件
-map<string, int> operators = {
-    // 单字符运算符
-    {"-", 33},
-    {"!", 37},
-    {"%", 39},
-    {"&", 41},
-    {"(", 44},
-    {")", 45},
-    {"*", 46},
-    {",", 48},
-    {".", 49},
-    {"/", 50},
-    {":", 52},
-    {";", 53},
-    {"?", 54},
-    {"[", 55},
-    {"]", 56},
-    {"^", 57},
-    {"{", 59},
-    {"|", 60},
-    {"}", 63},
-    {"~", 64},
-    {"+", 65},
-    {"<", 68},
-    {"=", 72},
-    {">", 74},
-    {"\"", 78},
-    // 双字符运算符
-    {"--", 34},
-    {"-=", 35},
-    {"->", 36},
-    {"!=", 38},
-    {"%=", 40},
-    {"&&", 42},
-    {"&=", 43},
-    {"*=", 47},
-    {"/=", 51},
-    {"^=", 58},
-    {"||", 61},
-    {"|=", 62},
-    {"++", 66},
-    {"+=", 67},
-    {"<<", 69},
-    {"<<=", 70},
-    {"<=", 71},
-    {"==", 73},
-    {">=", 75},
-    {">>", 76},
-    {">>=", 77}};
-
-int tokenCount = 0;
-
-// 输出 token 的函数
-void printToken(const string &name, int code)
+void printToken(string_view name, int code)
 {
-    tokenCount++;
-    cout << tokenCount << ": <" << name << "," << code << ">" << endl;
+    printToken(tokenOut, tokenCount, name, code);
 }
 
 // 判断是否为字母
@@ -101,357 +75,371 @@ bool isWhitespace(char c)
     return c == ' ' || c == '\t' || c == '\n' || c == '\r';
 }
 
-/* 基于 DFA 表驱动的词法分析器 */
-const int MAX_STATES = 500;
-const int ASCII_SIZE = 256;
-
-struct DFA
+// 记号：text 直接指向源缓冲区，不复制
+const int TOKEN_END = 0; // kind 为 0 表示输入已结束
+struct Token
 {
-    int trans[MAX_STATES][ASCII_SIZE];
-    int accept[MAX_STATES]; // 0 表示非接收态，>0 表示某类记号类别
-    int state_count;
+    int kind;         // 记号类别 CAT_*
+    int code;         // 种别码；字符串、字符常量为引号的种别码 78、77
+    string_view text; // 记号文本，字符串、字符常量包含两侧引号
+    uint64_t offset;  // 首字节在源缓冲区中的偏移；需要行号、列号时用 LineMap 换算
+    uint32_t sym;     // 标识符在 SymbolPool 中的编号，其他记号或未启用驻留时为 SYM_NONE
+    NumValue num;     // 常数的值，在生成记号时解码；其他记号的 num.type 为 NUM_NONE
+};
+
+// 按 kind 填写 num：常数在匹配后立即解码，之后各阶段直接使用 num，不必再用 atoi/atof 转换
+inline void decode_number(Token &tok)
+{
+    if (tok.kind == CAT_NUM)
+        parse_number(tok.text.data(), tok.text.size(), tok.num);
+    else
+        tok.num.type = NUM_NONE;
+}
 
-    void init()
+// 从 data[i] 开始做最长匹配，返回记号长度（0 表示无匹配），cat、code 为接收类别与种别码，stop 为 DFA 停下的位置
+// 要求 data[n] == '\0'（std::string 与 SourceBuffer 都满足）：'\0' 在转移表中单独成类且一律无转移，
+// 扫描循环因此不必逐字节检查 p < n，只在读到 '\0' 时区分末尾哨兵与源码中真实的 '\0'
+// 默认使用 LexTable.h 中的转移表；编译时定义 LEX_DIRECT_CODE 则改用 LexDirect.h 中直接编码的扫描器
+#ifdef LEX_DIRECT_CODE
+#include "LexDirect.h"
+#endif
+inline size_t longest_match(const unsigned char *data, size_t i, size_t n, int &cat, int &code, size_t &stop)
+{
+#ifdef LEX_DIRECT_CODE
+    return lex_match_direct(data, i, n, cat, code, stop);
+#else
+    int curr = 0; // Start state
+    int last_accept_state = -1;
+    size_t last_accept_pos = 0;
+    size_t p = i;
+
+    // Run DFA
+    while (true)
     {
-        memset(trans, -1, sizeof(trans));
-        memset(accept, 0, sizeof(accept));
-        state_count = 1; // 0 号状态作为起始状态
-    }
+        lex_state_t next = LEX_TRANS[curr][LEX_BYTE_CLASS[data[p]]];
+        if (next == LEX_NONE)
+        {
+            if (data[p] != 0 || p >= n)
+                break;
+            next = LEX_NUL_TRANS[curr];
+            if (next == LEX_NONE)
+                break;
+        }
 
-    int add_state()
-    {
-        return state_count++;
-    }
+        if (next == curr && LEX_SKIP[curr].n)
+        {
+            // 自环：整段跳过保持在本状态的字节，只在会改变状态的字节上回到查表
+            size_t q = lex_skip(data, p + 1, LEX_SKIP[curr]);
+            if (LEX_ACCEPT[curr] > 0)
+            {
+                last_accept_state = curr;
+                last_accept_pos = q - 1;
+            }
+            p = q;
+            continue;
+        }
 
-    void add_transition(int from, char c, int to)
-    {
-        trans[from][(unsigned char)c] = to;
+        curr = next;
+        if (LEX_ACCEPT[curr] > 0)
+        {
+            last_accept_state = curr;
+            last_accept_pos = p;
+        }
+        p++;
     }
-} dfa;
-
-// DFA 中的记号类别标签
-const int CAT_ID = 1;
-const int CAT_NUM = 2;
-const int CAT_STR = 3;
-const int CAT_CHAR = 4;
-const int CAT_OP = 5;
-const int CAT_COMMENT_LINE = 6;
-const int CAT_COMMENT_BLOCK = 7;
-const int CAT_WHITESPACE = 8;
-
-void init_dfa()
+
+    stop = p;
+    if (last_accept_state == -1)
+        return 0;
+    cat = LEX_ACCEPT[last_accept_state];
+    code = LEX_CODE[last_accept_state];
+    return last_accept_pos - i + 1;
+#endif
+}
+
+inline size_t longest_match(const unsigned char *data, size_t i, size_t n, int &cat)
 {
-    dfa.init();
+    int code;
+    size_t stop;
+    return longest_match(data, i, n, cat, code, stop);
+}
 
-    // 状态 0: 起始状态
-    int s_start = 0;
+// 最长匹配的备忘录（Reps 的线性时间最大吞噬算法）：未闭合的 "、/* 会让 DFA 一直读到输入末尾再回退，
+// 满是这类字符的输入按普通做法是 O(n^2)。这里记下最后一次接收之后经过的 (状态, 位置)，
+// 它们都不可能再到达接收态，之后的匹配一旦走到其中之一就立即停下，每个 (状态, 位置) 至多失败一次
+// 只有 DFA 明显多读（超过 LEX_MEMO_MIN 字节）时才启用，直到扫描越过记录的区域，平常的扫描不受影响
+const size_t LEX_MEMO_MIN = 64;
 
-    // 1. 空白字符
-    int s_ws = dfa.add_state();
-    dfa.accept[s_ws] = CAT_WHITESPACE;
-    string ws = " \t\n\r";
-    for (char c : ws)
-    {
-        dfa.add_transition(s_start, c, s_ws);
-        dfa.add_transition(s_ws, c, s_ws);
-    }
+class MunchMemo
+{
+public:
+    MunchMemo() : lo(0), hi(0) {}
 
-    // 2. 标识符 / 关键字（以字母或下划线开头）
-    int s_id = dfa.add_state();
-    dfa.accept[s_id] = CAT_ID;
-    for (int c = 0; c < 256; c++)
+    // pos 仍在记录的区域内时须改用 match()
+    bool covers(size_t pos) const { return pos < hi; }
+
+    // 从位置 i 开始新的记录区域
+    void open(size_t i)
     {
-        if (isLetter(c))
-            dfa.add_transition(s_start, c, s_id);
-        if (isLetter(c) || isDigit(c))
-            dfa.add_transition(s_id, c, s_id);
+        fail.clear();
+        reach.clear();
+        lo = hi = i;
     }
 
-    // 3. 数字（以数字开头）
-    int s_num = dfa.add_state();
-    dfa.accept[s_num] = CAT_NUM;
-    for (int c = 0; c < 256; c++)
+    // 供逐记号扫描的循环调用：平常直接用 longest_match()，DFA 读过头太多（未闭合的注释、字符串等）时
+    // 改用备忘录重新匹配，之后落在该区域内的匹配都走 match()，回退不再重复扫描
+    // stop 为 DFA 停下的位置；走备忘录时在记为失败的 (状态, 位置) 上提前停下，stop 取当初那次失败读到的位置
+    size_t longest(const unsigned char *data, size_t i, size_t n, int &cat, int &code, size_t &stop)
     {
-        if (isDigit(c))
-        {
-            dfa.add_transition(s_start, c, s_num);
-            dfa.add_transition(s_num, c, s_num);
-        }
-    }
-    // 浮点数与科学计数法使用更多状态（这里采用适度精简但足够鲁棒的方案）
-    // 为浮点数添加小数点状态
-    int s_dot = dfa.add_state();
-    dfa.add_transition(s_num, '.', s_dot);
-    int s_float = dfa.add_state();
-    dfa.accept[s_float] = CAT_NUM;
-    for (int c = 0; c < 256; c++)
-        if (isDigit(c))
-            dfa.add_transition(s_dot, c, s_float);
-    for (int c = 0; c < 256; c++)
-        if (isDigit(c))
-            dfa.add_transition(s_float, c, s_float);
-
-    // 科学计数法（e/E）
-    int s_sci = dfa.add_state();
-    int s_sci_sign = dfa.add_state();
-    int s_sci_val = dfa.add_state();
-    dfa.accept[s_sci_val] = CAT_NUM;
-
-    dfa.add_transition(s_num, 'e', s_sci);
-    dfa.add_transition(s_num, 'E', s_sci);
-    dfa.add_transition(s_float, 'e', s_sci);
-    dfa.add_transition(s_float, 'E', s_sci);
-
-    dfa.add_transition(s_sci, '+', s_sci_sign);
-    dfa.add_transition(s_sci, '-', s_sci_sign);
-    for (int c = 0; c < 256; c++)
-        if (isDigit(c))
+        if (!covers(i))
         {
-            dfa.add_transition(s_sci, c, s_sci_val);
-            dfa.add_transition(s_sci_sign, c, s_sci_val);
-            dfa.add_transition(s_sci_val, c, s_sci_val);
+            size_t len = longest_match(data, i, n, cat, code, stop);
+            if (stop - i - len <= LEX_MEMO_MIN)
+                return len;
+            open(i);
         }
-    // 数值后缀（f、l 等）
-    int s_suffix = dfa.add_state();
-    dfa.accept[s_suffix] = CAT_NUM;
-    string suffix = "flFL";
-    for (char c : suffix)
-    {
-        dfa.add_transition(s_num, c, s_suffix);
-        dfa.add_transition(s_float, c, s_suffix);
-        dfa.add_transition(s_sci_val, c, s_suffix);
+        return match(data, i, n, cat, code, stop);
     }
 
-    // 4. 字符串（以双引号开头）
-    int s_str_start = dfa.add_state();
-    int s_str_content = dfa.add_state();
-    int s_str_esc = dfa.add_state();
-    int s_str_end = dfa.add_state();
-    dfa.accept[s_str_end] = CAT_STR; // 仅在遇到闭合引号时视为接收态
-
-    dfa.add_transition(s_start, '"', s_str_start); // 起始引号
-    // 从起始引号进入内容或空串直接闭合
-    dfa.add_transition(s_str_start, '"', s_str_end); // 空串形式
-    for (int c = 0; c < 256; c++)
+    size_t longest(const unsigned char *data, size_t i, size_t n, int &cat, int &code)
     {
-        if (c != '"' && c != '\\')
-            dfa.add_transition(s_str_start, c, s_str_content);
+        size_t stop;
+        return longest(data, i, n, cat, code, stop);
     }
 
-    // 字符串内容部分
-    for (int c = 0; c < 256; c++)
+    // 与 longest_match() 结果相同的最长匹配，同时查询并更新备忘录；为保证线性不做 SIMD 跳过
+    size_t match(const unsigned char *data, size_t i, size_t n, int &cat, int &code, size_t &stop)
     {
-        if (c == '"')
-            dfa.add_transition(s_str_content, c, s_str_end);
-        else if (c == '\\')
-            dfa.add_transition(s_str_content, c, s_str_esc);
-        else
-            dfa.add_transition(s_str_content, c, s_str_content);
-    }
+        int curr = 0;
+        int last_accept_state = -1;
+        size_t last_accept_pos = 0;
+        size_t p = i;
+        stop = (size_t)-1;
+        while (true)
+        {
+            if (failed(curr, p))
+            {
+                stop = reach[p - lo]; // 从这里起与当初那次失败走的是同一条路径
+                break;
+            }
+            lex_state_t next = LEX_TRANS[curr][LEX_BYTE_CLASS[data[p]]];
+            if (next == LEX_NONE)
+            {
+                if (data[p] != 0 || p >= n)
+                    break;
+                next = LEX_NUL_TRANS[curr];
+                if (next == LEX_NONE)
+                    break;
+            }
+            curr = next;
+            if (LEX_ACCEPT[curr] > 0)
+            {
+                last_accept_state = curr;
+                last_accept_pos = p;
+            }
+            p++;
+        }
 
-    // 转义字符后回到内容状态
-    for (int c = 0; c < 256; c++)
-        dfa.add_transition(s_str_esc, c, s_str_content);
+        if (stop == (size_t)-1)
+            stop = p;
 
-    // 5. 字符常量（以单引号开头）
-    int s_char_start = dfa.add_state();
-    int s_char_content = dfa.add_state();
-    int s_char_esc = dfa.add_state();
-    int s_char_end = dfa.add_state();
-    dfa.accept[s_char_end] = CAT_CHAR;
+        // 从最后一次接收之后重走到停下的位置，沿途的 (状态, 位置) 都记为失败，并记下这次失败读到的位置
+        if (p + 1 > hi)
+        {
+            hi = p + 1;
+            fail.resize(hi - lo, 0);
+            reach.resize(hi - lo, 0);
+        }
+        int s = last_accept_state == -1 ? 0 : last_accept_state;
+        for (size_t q = last_accept_state == -1 ? i : last_accept_pos + 1; q < p; q++)
+        {
+            mark(s, q, stop);
+            lex_state_t t = LEX_TRANS[s][LEX_BYTE_CLASS[data[q]]];
+            s = t != LEX_NONE ? t : LEX_NUL_TRANS[s]; // q < p 处必有转移，查不到只可能是源码中的 '\0'
+        }
+        mark(s, p, stop);
 
-    dfa.add_transition(s_start, '\'', s_char_start);
-    for (int c = 0; c < 256; c++)
-    {
-        if (c != '\'' && c != '\\')
-            dfa.add_transition(s_char_start, c, s_char_content);
+        if (last_accept_state == -1)
+            return 0;
+        cat = LEX_ACCEPT[last_accept_state];
+        code = LEX_CODE[last_accept_state];
+        return last_accept_pos - i + 1;
     }
-    dfa.add_transition(s_char_start, '\\', s_char_esc); // 处理转义字符
 
-    for (int c = 0; c < 256; c++)
-    {
-        if (c == '\'')
-            dfa.add_transition(s_char_content, c, s_char_end);
-        else
-            dfa.add_transition(s_char_content, c, s_char_content); // 按理字符长度应为 1，此处放宽以方便错误恢复
-    }
-    for (int c = 0; c < 256; c++)
-        dfa.add_transition(s_char_esc, c, s_char_content);
-
-    // 6. 注释（以 / 开头）
-    int s_slash = dfa.add_state();
-    dfa.accept[s_slash] = CAT_OP; // 如果后面不是注释起始，则单独视为运算符 /
-    dfa.add_transition(s_start, '/', s_slash);
-
-    // 行注释 //
-    int s_line_com = dfa.add_state();
-    dfa.accept[s_line_com] = CAT_COMMENT_LINE; // 在遇到换行之前都视为处于注释内部
-    dfa.add_transition(s_slash, '/', s_line_com);
-    for (int c = 0; c < 256; c++)
+private:
+    vector<lex_fail_t> fail; // fail[p - lo]：在位置 p 处注定失败的状态集合
+    vector<size_t> reach;    // reach[p - lo]：经过位置 p 的失败中最远读到的位置
+    size_t lo, hi;
+
+    void mark(int s, size_t p, size_t stop)
     {
-        if (c != '\n')
-            dfa.add_transition(s_line_com, c, s_line_com);
+        fail[p - lo] |= LEX_FAIL_BIT[s];
+        reach[p - lo] = max(reach[p - lo], stop);
     }
 
-    // 块注释 /*
-    int s_block_com = dfa.add_state();
-    int s_block_com_star = dfa.add_state();
-    int s_block_com_end = dfa.add_state();
-    dfa.accept[s_block_com_end] = CAT_COMMENT_BLOCK;
-
-    dfa.add_transition(s_slash, '*', s_block_com);
-    for (int c = 0; c < 256; c++)
+    bool failed(int s, size_t p) const
     {
-        if (c == '*')
-            dfa.add_transition(s_block_com, c, s_block_com_star);
-        else
-            dfa.add_transition(s_block_com, c, s_block_com);
+        return p >= lo && p < hi && (fail[p - lo] & LEX_FAIL_BIT[s]);
     }
+};
 
-    for (int c = 0; c < 256; c++)
+// 输出一个记号，字符串、字符常量拆成引号、内容、引号三项
+void printToken(TokenWriter &out, long long &count, const Token &tok)
+{
+    if (tok.kind == CAT_STR || tok.kind == CAT_CHAR)
     {
-        if (c == '/')
-            dfa.add_transition(s_block_com_star, c, s_block_com_end);
-        else if (c == '*')
-            dfa.add_transition(s_block_com_star, c, s_block_com_star); // 保持在连续 * 的状态
-        else
-            dfa.add_transition(s_block_com_star, c, s_block_com); // 回到注释内容状态
+        // Original logic output: " then content then "
+        string_view quote = tok.text.substr(0, 1);
+        string_view content = tok.text.substr(1, tok.text.size() - 2);
+        printToken(out, count, quote, tok.code);
+        if (!content.empty())
+            printToken(out, count, content, 81);
+        printToken(out, count, quote, tok.code);
+        return;
     }
+    printToken(out, count, tok.text, tok.code);
+}
 
-    // 7. 运算符
-    // 为所有运算符在 DFA 中构建类似 Trie 的状态路径
-    // 注意：以 / 开头的情形已经由 s_slash 处理，这里只补充其余情况；/=
-    // 通过单独逻辑挂接到 s_slash 之后
+void printToken(const Token &tok)
+{
+    printToken(tokenOut, tokenCount, tok);
+}
 
-    for (map<string, int>::const_iterator it = operators.begin(); it != operators.end(); ++it)
-    {
-        const string &op = it->first;
-        int code = it->second;
+// 常用的 sink；任何带有 void onToken(const Token &) 的类型都可以作 Sink，例如把记号逐个送进语法分析器的驱动
 
-        if (op[0] == '/')
-        {
-            // 对 /= 做特殊处理，将其连接到 s_slash 之后
-            if (op == "/=")
-            {
-                int s_diveq = dfa.add_state();
-                dfa.accept[s_diveq] = CAT_OP;
-                dfa.add_transition(s_slash, '=', s_diveq);
-            }
-            continue; // 单独的 / 已经在前面处理
-        }
+// 丢弃全部记号，只用 next() 时的缺省 Sink
+struct NullSink
+{
+    void onToken(const Token &) {}
+};
+
+// 只计数
+struct CountSink
+{
+    long long tokens;
+    CountSink() : tokens(0) {}
+    void onToken(const Token &) { tokens++; }
+};
+
+// 收集成数组，供需要回看的语法分析等使用
+struct VectorSink
+{
+    vector<Token> tokens;
+    void onToken(const Token &tok) { tokens.push_back(tok); }
+};
 
-        int curr = s_start;
-        for (size_t idx = 0; idx < op.size(); ++idx)
+// 按 printToken() 的格式写入 out；count 为此前已输出的记号数，序号从 count + 1 开始
+struct PrintSink
+{
+    TokenWriter &out;
+    long long count;
+    explicit PrintSink(TokenWriter &out, long long count = 0) : out(out), count(count) {}
+    void onToken(const Token &tok) { printToken(out, count, tok); }
+};
+
+// 词法分析器：每次 next() 返回下一个记号，跳过空白，注释作为种别码 79 的记号返回；
+// 或由 run() 把全部记号依次推给 sink 的 onToken(const Token &)
+// Sink 是模板参数而非虚函数或 std::function，onToken 在编译期确定并可内联，每种 Sink 各得一份专门的扫描循环
+// Lexer 不读写任何全局变量，各实例（连同各自的 sink）可在不同线程上同时运行
+// 源缓冲区须满足 data[n] == '\0'，且在 Lexer 使用期间保持有效
+// 给出 pool 时，标识符在扫描的同时驻留到 pool 中，记号的 sym 为其编号；pool 可在多个 Lexer 间共用（但不能跨线程共用）
+template <typename Sink = NullSink>
+class Lexer
+{
+public:
+    // 只用 next() 拉取记号时 Sink 取默认的 NullSink：Lexer lexer(data, n)
+    Lexer(const char *data, size_t n, SymbolPool *pool = NULL) : data(data), n(n), pos(0), pool(pool) {}
+    // sink 按值保存，run() 之后由 sink() 取回其中的结果：Lexer lexer(CountSink(), data, n)
+    Lexer(const Sink &sink, const char *data, size_t n, SymbolPool *pool = NULL)
+        : data(data), n(n), pos(0), pool(pool), out(sink) {}
+
+    Token next()
+    {
+        const unsigned char *src = (const unsigned char *)data;
+        while (pos < n)
         {
-            char c = op[idx];
-            int next = dfa.trans[curr][(unsigned char)c];
-            if (next == -1)
+            int cat = 0, code = 0;
+            size_t len = memo.longest(src, pos, n, cat, code);
+            if (len == 0)
             {
-                next = dfa.add_state();
-                dfa.add_transition(curr, c, next);
+                // No token matched, skip one char (or error)
+                pos++;
+                continue;
             }
-            curr = next;
-        }
-        dfa.accept[curr] = CAT_OP;
-    }
-}
 
-void Analysis(istream &in = cin)
-{
-    init_dfa();
-
-    string prog;
-    read_prog(prog, in);
+            Token tok;
+            tok.kind = cat;
+            tok.text = string_view(data + pos, len);
+            tok.offset = pos;
+            pos += len;
+            if (cat == CAT_WHITESPACE)
+                continue;
+            tok.code = code;
+            tok.sym = pool && cat == CAT_ID ? pool->intern(tok.text) : SYM_NONE;
+            decode_number(tok);
+            return tok;
+        }
 
-    int i = 0;
-    int n = prog.length();
+        Token end;
+        end.kind = TOKEN_END;
+        end.code = 0;
+        end.offset = n;
+        end.sym = SYM_NONE;
+        end.num.type = NUM_NONE;
+        return end;
+    }
 
-    while (i < n)
+    // 把余下的全部记号交给 sink
+    void run()
     {
-        int curr = 0; // Start state
-        int last_accept_state = -1;
-        int last_accept_pos = -1;
-        int p = i;
+        for (Token tok = next(); tok.kind != TOKEN_END; tok = next())
+            out.onToken(tok);
+    }
 
-        // Run DFA
-        while (p < n)
-        {
-            char c = prog[p];
-            int next = dfa.trans[curr][(unsigned char)c];
+    Sink &sink() { return out; }
 
-            if (next != -1)
-            {
-                curr = next;
-                if (dfa.accept[curr] > 0)
-                {
-                    last_accept_state = curr;
-                    last_accept_pos = p;
-                }
-                p++;
-            }
-            else
-            {
-                break;
-            }
-        }
+    // 从偏移 p 处接着扫描（预处理器按自己的规则界定了字符串常量之后用）
+    void seek(size_t p) { pos = p; }
 
-        if (last_accept_state != -1)
-        {
-            // Token found
-            string token = prog.substr(i, last_accept_pos - i + 1);
-            int cat = dfa.accept[last_accept_state];
+private:
+    const char *data;
+    size_t n;
+    size_t pos;
+    MunchMemo memo;
+    SymbolPool *pool;
+    Sink out;
+};
 
-            if (cat == CAT_WHITESPACE)
-            {
-                // Ignore
-            }
-            else if (cat == CAT_COMMENT_LINE || cat == CAT_COMMENT_BLOCK)
-            {
-                printToken(token, 79);
-            }
-            else if (cat == CAT_ID)
-            {
-                if (keywords.find(token) != keywords.end())
-                {
-                    printToken(token, keywords[token]);
-                }
-                else
-                {
-                    printToken(token, 81);
-                }
-            }
-            else if (cat == CAT_NUM)
-            {
-                printToken(token, 80);
-            }
-            else if (cat == CAT_STR)
-            {
-                // Original logic output: " then content then "
-                printToken("\"", 78);
-                string content = token.substr(1, token.length() - 2);
-                if (!content.empty())
-                    printToken(content, 81);
-                printToken("\"", 78);
-            }
-            else if (cat == CAT_CHAR)
-            {
-                printToken("'", 77);
-                string content = token.substr(1, token.length() - 2);
-                if (!content.empty())
-                    printToken(content, 81);
-                printToken("'", 77);
-            }
-            else if (cat == CAT_OP)
-            {
-                printToken(token, operators[token]);
-            }
+// 输出一个已匹配的词素，供不经过 Lexer 的扫描方式（如 StreamLexer）使用
+void emitToken(const char *prog, size_t start, size_t len, int cat, int code)
+{
+    if (cat == CAT_WHITESPACE)
+        return; // Ignore
+
+    Token tok;
+    tok.kind = cat;
+    tok.text = string_view(prog + start, len);
+    tok.code = code;
+    tok.offset = start;
+    tok.sym = SYM_NONE;
+    tok.num.type = NUM_NONE; // 只用于输出，不解码
+    printToken(tok);
+}
 
-            i = last_accept_pos + 1;
-        }
-        else
-        {
-            // No token matched, skip one char (or error)
-            i++;
-        }
-    }
+// 输出全部记号，自动机由 maker.cpp 预先生成（见 LexTable.h / LexDirect.h）
+// data 须满足 data[n] == '\0'
+void scan(const char *prog, size_t n)
+{
+    Lexer<PrintSink> lexer(PrintSink(tokenOut, tokenCount), prog, n);
+    lexer.run();
+    tokenCount = lexer.sink().count;
+    tokenOut.flush();
+}
+
+void Analysis(istream &in = cin)
+{
+    string prog;
+    read_prog(prog, in);
+    scan(prog.data(), prog.size());
 }
+#endif
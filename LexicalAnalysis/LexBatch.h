@@ -0,0 +1,517 @@
+// 批量读入大量小文件：Linux 上用 io_uring，每个文件提交一条 OPENAT → READ 的链接请求（打开到注册的直接描述符槽，
+// 下一个文件打开到同一槽时内核顺带关闭上一个，不必单独 CLOSE），同时保持 depth 个文件在途，调用者分析当前文件时后面文件的打开与读入在内核中进行；
+// 内核不支持 io_uring 时改由后台线程用 open/pread 预读（只有一个核时直接同步读）。文件总是按给定的顺序交给调用者
+#ifndef LEX_BATCH_H
+#define LEX_BATCH_H
+#include "LexAnalysis.h"
+#include "LexInput.h"
+#include "LexUtf8.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if !defined(_WIN32)
+#include <dirent.h>
+#endif
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+// 交给调用者的一个文件，data[size] 为 '\0'，可直接交给 scan()/Lexer
+struct BatchFile
+{
+    string path;
+    const char *data;
+    size_t size;
+    int error; // 打开或读入失败时的 errno，成功为 0
+};
+
+class BatchReader
+{
+public:
+    // depth 为同时在途的文件数；io_uring 上每个文件先按 cap 字节读一次，读满的文件（可能更长）改为同步映射
+    // use_uring 为 false 时直接使用后台线程预读（只用于比较）
+    BatchReader(const vector<string> &paths, int depth = 32, size_t cap = 1 << 16, bool use_uring = true)
+        : paths(paths), depth(depth < 1 ? 1 : depth > 1024 ? 1024 : depth), cap(cap < 64 ? 64 : cap), slots(this->depth),
+          cur(0), issued(0), ring_fd(-1), queued(0), ring_error(0), stop(false), user_waits(false), reader_waits(false)
+    {
+        if (use_uring && setup_ring())
+            return;
+        if (thread::hardware_concurrency() > 1)
+            reader = thread(&BatchReader::prefetch, this);
+    }
+
+    ~BatchReader()
+    {
+        if (ring_fd >= 0)
+        {
+            drain(); // 在途请求仍会写入各槽的缓冲区，等全部完成后才能释放
+            teardown_ring();
+        }
+        else if (reader.joinable())
+        {
+            {
+                lock_guard<mutex> lock(mu);
+                stop = true;
+            }
+            cv.notify_all();
+            reader.join();
+        }
+    }
+
+    bool uring() const { return ring_fd >= 0; }
+
+    // 按 paths 的顺序取下一个文件，全部取完时返回 NULL；返回的文件在下次调用 next() 之前有效
+    const BatchFile *next()
+    {
+        if (cur == paths.size())
+            return NULL;
+        Slot &s = slots[cur % depth];
+        if (ring_fd >= 0)
+            wait_ring(s);
+        else if (!reader.joinable())
+        {
+            // 只有一个核时另开线程预读不会与分析重叠，反而多出线程切换，直接在这里读
+            size_t size = 0;
+            int error = read_whole(paths[cur], s.buf, size);
+            s.index = cur;
+            finish(s, size, error);
+        }
+        else
+        {
+            unique_lock<mutex> lock(mu);
+            if (cur > 0)
+            {
+                slots[(cur - 1) % depth].busy = false; // 上一个文件已分析完，槽可以给预读线程复用
+                if (reader_waits)
+                    cv.notify_all();
+            }
+            if (!(s.busy && s.index == cur))
+            {
+                user_waits = true;
+                cv.wait(lock, [&] { return s.busy && s.index == cur; });
+                user_waits = false;
+            }
+        }
+        cur++;
+        return &s.file;
+    }
+
+private:
+    // 一个在途文件所用的缓冲区；文件 i 固定使用第 i % depth 个槽
+    struct Slot
+    {
+        vector<char> buf;
+        SourceBuffer big; // io_uring 上读满 cap 的文件改为同步映射
+        BatchFile file;
+        size_t index;     // 当前所装文件的下标
+        int waiting;      // io_uring：尚未收到的完成事件数（打开、读入各一个）
+        bool busy;        // 预读线程：已装入、尚未被调用者用完
+        Slot() : index((size_t)-1), waiting(0), busy(false) {}
+    };
+
+    vector<string> paths;
+    int depth;
+    size_t cap;
+    vector<Slot> slots;
+    size_t cur;    // 下一个交给调用者的文件
+    size_t issued; // 已提交（或已开始预读）的文件数
+
+    // io_uring 的提交队列、完成队列与请求数组，均为与内核共享的映射
+    int ring_fd;
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+#if defined(__linux__)
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+#endif
+    void *sq_map, *cq_map, *sqe_map;
+    size_t sq_len, cq_len, sqe_len;
+    unsigned queued; // 已写入提交队列、尚未 io_uring_enter 的请求数
+    int ring_error;  // io_uring_enter 出现无法重试的错误时的 errno，此后不再提交，余下的文件都以它报错
+
+    // 预读线程
+    thread reader;
+    mutex mu;
+    condition_variable cv;
+    bool stop;
+    bool user_waits, reader_waits; // 只在对方正在等待时才唤醒，省去每个文件两次无用的唤醒
+
+    // 文件装入槽后填写 file：data 指向缓冲区并补上 '\0'
+    void finish(Slot &s, size_t size, int error)
+    {
+        s.file.path = paths[s.index];
+        s.file.error = error;
+        s.file.size = error ? 0 : size;
+        if (error)
+            s.file.data = "";
+        else
+        {
+            s.buf[size] = '\0';
+            s.file.data = s.buf.data();
+        }
+    }
+
+    // ---- 后台线程 + pread ----
+
+    void prefetch()
+    {
+        for (size_t i = 0; i < paths.size(); i++)
+        {
+            Slot &s = slots[i % depth];
+            {
+                unique_lock<mutex> lock(mu);
+                reader_waits = true;
+                cv.wait(lock, [&] { return stop || !s.busy; });
+                reader_waits = false;
+                if (stop)
+                    return;
+            }
+            size_t size = 0;
+            int error = read_whole(paths[i], s.buf, size);
+            lock_guard<mutex> lock(mu);
+            s.index = i;
+            finish(s, size, error);
+            s.busy = true;
+            if (user_waits)
+                cv.notify_all();
+        }
+    }
+
+    // 读入整个文件到 buf（末尾多留一个字节放 '\0'），返回 errno，成功为 0
+    static int read_whole(const string &path, vector<char> &buf, size_t &size)
+    {
+#if !defined(_WIN32)
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return errno;
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            int e = errno;
+            ::close(fd);
+            return e;
+        }
+        size_t want = S_ISREG(st.st_mode) ? (size_t)st.st_size : 0;
+        if (buf.size() < want + 1)
+            buf.resize(want + 1);
+        size = 0;
+        for (;;)
+        {
+            if (size + 1 == buf.size())
+                buf.resize(buf.size() * 2); // 文件在读的过程中变长，或不是普通文件
+            ssize_t got = pread(fd, buf.data() + size, buf.size() - 1 - size, size);
+            if (got < 0 && errno == EINTR)
+                continue;
+            if (got < 0)
+            {
+                int e = errno;
+                ::close(fd);
+                return e;
+            }
+            if (got == 0)
+                break;
+            size += got;
+            if (S_ISREG(st.st_mode) && size == want)
+                break; // 已读到 fstat 给出的长度，省去一次读到末尾的 pread
+        }
+        ::close(fd);
+        return 0;
+#else
+        ifstream in(path.c_str(), ios::binary);
+        if (!in)
+            return ENOENT;
+        string s((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        buf.assign(s.begin(), s.end());
+        buf.push_back('\0');
+        size = s.size();
+        return 0;
+#endif
+    }
+
+    // ---- io_uring ----
+
+#if defined(__linux__)
+    // 建立队列并注册 depth 个空的直接描述符槽，打开的文件放进槽里，读按槽号引用，
+    // 打开与读入可以在一次提交中链接起来；任何一步不受支持都返回 false，改用预读线程
+    bool setup_ring()
+    {
+        // 完成事件只在等待时处理即可，不必打断正在分析的线程；旧内核不认这个标志时不带标志再建一次
+        struct io_uring_params p;
+        memset(&p, 0, sizeof(p));
+        p.flags = IORING_SETUP_COOP_TASKRUN;
+        int fd = syscall(__NR_io_uring_setup, (unsigned)(2 * depth), &p);
+        if (fd < 0)
+        {
+            memset(&p, 0, sizeof(p));
+            fd = syscall(__NR_io_uring_setup, (unsigned)(2 * depth), &p);
+        }
+        if (fd < 0)
+            return false;
+        ring_fd = fd;
+        sq_map = cq_map = sqe_map = MAP_FAILED;
+        sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+        if (p.features & IORING_FEAT_SINGLE_MMAP)
+            sq_len = cq_len = max(sq_len, cq_len);
+        sqe_len = p.sq_entries * sizeof(struct io_uring_sqe);
+        sq_map = mmap(NULL, sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sq_map != MAP_FAILED)
+            cq_map = p.features & IORING_FEAT_SINGLE_MMAP
+                         ? sq_map
+                         : mmap(NULL, cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (cq_map != MAP_FAILED)
+            sqe_map = mmap(NULL, sqe_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        struct io_uring_rsrc_register reg;
+        memset(&reg, 0, sizeof(reg));
+        reg.nr = depth;
+        reg.flags = IORING_RSRC_REGISTER_SPARSE;
+        if (sqe_map == MAP_FAILED || syscall(__NR_io_uring_register, fd, IORING_REGISTER_FILES2, &reg, sizeof(reg)) < 0)
+        {
+            teardown_ring();
+            return false;
+        }
+        char *sq = (char *)sq_map, *cq = (char *)cq_map;
+        sq_head = (unsigned *)(sq + p.sq_off.head);
+        sq_tail = (unsigned *)(sq + p.sq_off.tail);
+        sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+        sq_array = (unsigned *)(sq + p.sq_off.array);
+        cq_head = (unsigned *)(cq + p.cq_off.head);
+        cq_tail = (unsigned *)(cq + p.cq_off.tail);
+        cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+        sqes = (struct io_uring_sqe *)sqe_map;
+        cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+        for (Slot &s : slots)
+            s.buf.resize(cap + 1);
+        return true;
+    }
+
+    void teardown_ring()
+    {
+        if (sqe_map != MAP_FAILED)
+            munmap(sqe_map, sqe_len);
+        if (cq_map != MAP_FAILED && cq_map != sq_map)
+            munmap(cq_map, cq_len);
+        if (sq_map != MAP_FAILED)
+            munmap(sq_map, sq_len);
+        ::close(ring_fd);
+        ring_fd = -1;
+    }
+
+    struct io_uring_sqe *get_sqe()
+    {
+        unsigned tail = *sq_tail; // 只有本线程写 tail
+        struct io_uring_sqe *e = &sqes[tail & *sq_mask];
+        memset(e, 0, sizeof(*e));
+        sq_array[tail & *sq_mask] = tail & *sq_mask;
+        __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+        queued++;
+        return e;
+    }
+
+    // 第 i 个文件放进第 i % depth 个槽：打开到直接描述符槽（替换并关闭槽中上一个文件），链接读入最多 cap 字节；
+    // 打开失败时读入以 -ECANCELED 完成。两步各有一个完成事件，完成事件只是共享内存中的一项，不多花系统调用
+    void submit_file(size_t i)
+    {
+        unsigned k = i % depth;
+        Slot &s = slots[k];
+        s.index = i;
+        s.waiting = 2;
+        s.file.error = 0;
+        s.file.size = 0;
+
+        struct io_uring_sqe *e = get_sqe();
+        e->opcode = IORING_OP_OPENAT;
+        e->fd = AT_FDCWD;
+        e->addr = (uint64_t)(uintptr_t)paths[i].c_str();
+        e->open_flags = O_RDONLY; // 直接描述符不在进程的描述符表中，内核不接受 O_CLOEXEC
+        e->file_index = k + 1;
+        e->flags = IOSQE_IO_LINK;
+        e->user_data = (uint64_t)k << 2 | 0;
+
+        e = get_sqe();
+        e->opcode = IORING_OP_READ;
+        e->fd = k;
+        e->addr = (uint64_t)(uintptr_t)s.buf.data();
+        e->len = cap;
+        e->off = 0;
+        e->flags = IOSQE_FIXED_FILE;
+        e->user_data = (uint64_t)k << 2 | 1;
+    }
+
+    // 取走已到的完成事件
+    void reap()
+    {
+        unsigned head = *cq_head;
+        unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++)
+        {
+            const struct io_uring_cqe &c = cqes[head & *cq_mask];
+            Slot &s = slots[c.user_data >> 2];
+            int step = c.user_data & 3;
+            if (step == 0 && c.res < 0)
+                s.file.error = -c.res;
+            else if (step == 1 && c.res >= 0)
+                s.file.size = c.res;
+            else if (step == 1 && c.res != -ECANCELED && !s.file.error)
+                s.file.error = -c.res;
+            s.waiting--;
+        }
+        __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    // 提交已排队的请求，min_complete 大于 0 时等待至少这么多个完成事件；成功返回 0，
+    // 无法重试的错误（EBADF、EFAULT、ENOMEM 等）返回 errno，并把在途的槽都记为以该错误失败，调用者不必再等
+    int enter(unsigned min_complete)
+    {
+        for (;;)
+        {
+            long r = syscall(__NR_io_uring_enter, ring_fd, queued, min_complete, min_complete ? IORING_ENTER_GETEVENTS : 0,
+                             NULL, 0);
+            if (r >= 0)
+            {
+                queued -= r;
+                if (queued == 0)
+                    return 0;
+                min_complete = 0;
+            }
+            else if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            {
+                ring_error = errno;
+                for (Slot &s : slots)
+                    if (s.waiting > 0)
+                    {
+                        s.waiting = 0;
+                        if (!s.file.error)
+                            s.file.error = ring_error;
+                    }
+                queued = 0;
+                return ring_error;
+            }
+            else
+                reap(); // 完成队列满时先腾出位置
+        }
+    }
+
+    // 补足在途的文件，再等到 s 所装的第 cur 个文件读入完成
+    void wait_ring(Slot &s)
+    {
+        for (; !ring_error;)
+        {
+            // 第 issued 个文件的槽原先装的是第 issued - depth 个文件，须已读入完成并交给调用者
+            while (issued < paths.size() && issued < cur + depth && slots[issued % depth].waiting == 0)
+                submit_file(issued++);
+            // 排好的请求立即提交，调用者分析当前文件时内核已在读入后面的文件，不等到下次阻塞才交出去
+            if (queued > 0 && enter(0))
+                break;
+            reap();
+            if (s.index == cur && s.waiting == 0)
+                break;
+            if (enter(1))
+                break;
+        }
+        if (s.index != cur)
+        {
+            // 队列出错时第 cur 个文件还没提交，直接以该错误交给调用者
+            s.index = cur;
+            finish(s, 0, ring_error);
+            return;
+        }
+        if (!s.file.error && s.file.size == cap)
+        {
+            // 读满了缓冲区，文件可能更长，整个映射
+            if (!s.big.open_file(paths[cur].c_str()))
+                s.file.error = errno ? errno : EIO;
+            s.file.path = paths[cur];
+            s.file.size = s.big.size();
+            s.file.data = s.file.error ? "" : s.big.data();
+            return;
+        }
+        size_t size = s.file.size;
+        finish(s, size, s.file.error);
+    }
+
+    void drain()
+    {
+        if (queued > 0 && enter(0))
+            return;
+        for (;;)
+        {
+            int left = 0;
+            for (const Slot &s : slots)
+                left += s.waiting;
+            if (left == 0 || enter(1))
+                return;
+            reap();
+        }
+    }
+#else
+    bool setup_ring() { return false; }
+    void teardown_ring() {}
+    void wait_ring(Slot &) {}
+    void drain() {}
+#endif
+};
+
+// 收集 path 下的全部普通文件（递归子目录，按路径排序）；path 本身是文件时只收集它，无法打开的目录忽略
+void list_sources(const string &path, vector<string> &out)
+{
+#if !defined(_WIN32)
+    DIR *dir = opendir(path.c_str());
+    if (!dir)
+    {
+        out.push_back(path);
+        return;
+    }
+    vector<string> names;
+    while (struct dirent *d = readdir(dir))
+        if (strcmp(d->d_name, ".") != 0 && strcmp(d->d_name, "..") != 0)
+            names.push_back(d->d_name);
+    closedir(dir);
+    sort(names.begin(), names.end());
+    string prefix = path.empty() || path.back() == '/' ? path : path + "/";
+    for (const string &n : names)
+    {
+        string full = prefix + n;
+        struct stat st;
+        if (stat(full.c_str(), &st) != 0)
+            continue;
+        if (S_ISDIR(st.st_mode))
+            list_sources(full, out);
+        else if (S_ISREG(st.st_mode))
+            out.push_back(full);
+    }
+#else
+    out.push_back(path);
+#endif
+}
+
+// 依次分析 paths 中的文件：每个文件先输出一行 “==> 路径 <==”，记号从 1 重新编号，与单独分析该文件的输出相同；
+// 整批只在最后刷出一次输出。返回无法读入的文件数，错误信息输出到标准错误
+int batch_scan(const vector<string> &paths, int depth = 32)
+{
+    BatchReader reader(paths, depth);
+    int failed = 0;
+    for (const BatchFile *f = reader.next(); f; f = reader.next())
+    {
+        if (f->error)
+        {
+            cerr << "Cannot open file: " << f->path << ": " << strerror(f->error) << endl;
+            failed++;
+            continue;
+        }
+        string warning;
+        if (!check_utf8(f->data, f->size, f->path, warning))
+            cerr << warning << endl;
+        tokenOut.put("==> ");
+        tokenOut.put(f->path);
+        tokenOut.put(" <==\n");
+        Lexer<PrintSink> lexer(PrintSink(tokenOut, 0), f->data, f->size);
+        lexer.run();
+    }
+    tokenOut.flush();
+    return failed;
+}
+#endif
@@ -0,0 +1,4357 @@
+#ifndef LEX_DIRECT_H
+#define LEX_DIRECT_H
+// 由 maker.cpp 自动生成，请勿手工修改
+#include <cstddef>
+#include "LexSimd.h"
+// 从 data[i] 开始做最长匹配，返回记号长度（0 表示无匹配），cat、code 为接收类别与种别码，stop 为 DFA 停下的位置
+// 要求 data[n] == '\0'：只有读到 '\0' 时才检查是否到达末尾
+inline size_t lex_match_direct(const unsigned char *data, size_t i, size_t n, int &cat, int &code, size_t &stop)
+{
+    size_t p = i;
+    size_t last = 0;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 11: case 12: case 14: case 15: case 16: case 17: case 18: case 19:
+    case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27:
+    case 28: case 29: case 30: case 31: case 35: case 36: case 64: case 92:
+    case 96: case 127:
+        goto done;
+    case 9: case 10: case 13: case 32:
+        p++;
+        goto s1;
+    case 33:
+        p++;
+        goto s2;
+    case 34:
+        p++;
+        goto s3;
+    case 37:
+        p++;
+        goto s4;
+    case 38:
+        p++;
+        goto s5;
+    case 39:
+        p++;
+        goto s6;
+    case 40:
+        p++;
+        goto s7;
+    case 41:
+        p++;
+        goto s8;
+    case 42:
+        p++;
+        goto s9;
+    case 43:
+        p++;
+        goto s10;
+    case 44:
+        p++;
+        goto s11;
+    case 45:
+        p++;
+        goto s12;
+    case 46:
+        p++;
+        goto s13;
+    case 47:
+        p++;
+        goto s14;
+    case 48:
+        p++;
+        goto s15;
+    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+    case 57:
+        p++;
+        goto s16;
+    case 58:
+        p++;
+        goto s17;
+    case 59:
+        p++;
+        goto s18;
+    case 60:
+        p++;
+        goto s19;
+    case 61:
+        p++;
+        goto s20;
+    case 62:
+        p++;
+        goto s21;
+    case 63:
+        p++;
+        goto s22;
+    case 91:
+        p++;
+        goto s24;
+    case 93:
+        p++;
+        goto s25;
+    case 94:
+        p++;
+        goto s26;
+    case 97:
+        p++;
+        goto s27;
+    case 98:
+        p++;
+        goto s28;
+    case 99:
+        p++;
+        goto s29;
+    case 100:
+        p++;
+        goto s30;
+    case 101:
+        p++;
+        goto s31;
+    case 102:
+        p++;
+        goto s32;
+    case 103:
+        p++;
+        goto s33;
+    case 105:
+        p++;
+        goto s34;
+    case 108:
+        p++;
+        goto s35;
+    case 114:
+        p++;
+        goto s36;
+    case 115:
+        p++;
+        goto s37;
+    case 116:
+        p++;
+        goto s38;
+    case 117:
+        p++;
+        goto s39;
+    case 118:
+        p++;
+        goto s40;
+    case 119:
+        p++;
+        goto s41;
+    case 123:
+        p++;
+        goto s42;
+    case 124:
+        p++;
+        goto s43;
+    case 125:
+        p++;
+        goto s44;
+    case 126:
+        p++;
+        goto s45;
+    default:
+        p++;
+        goto s23;
+    }
+s1:
+    last = p - i;
+    cat = 9;
+    code = 0;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 9: case 10: case 13: case 32:
+        p++;
+        goto s1;
+    default:
+        goto done;
+    }
+s2:
+    last = p - i;
+    cat = 6;
+    code = 37;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s46;
+    default:
+        goto done;
+    }
+s3:
+    last = p - i;
+    cat = 6;
+    code = 78;
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s47;
+    case 92:
+        goto done;
+    case 34:
+        p++;
+        goto s48;
+    default:
+        p++;
+        goto s47;
+    }
+s4:
+    last = p - i;
+    cat = 6;
+    code = 39;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s49;
+    default:
+        goto done;
+    }
+s5:
+    last = p - i;
+    cat = 6;
+    code = 41;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 38:
+        p++;
+        goto s50;
+    case 61:
+        p++;
+        goto s51;
+    default:
+        goto done;
+    }
+s6:
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s52;
+    case 39:
+        goto done;
+    case 92:
+        p++;
+        goto s53;
+    default:
+        p++;
+        goto s52;
+    }
+s7:
+    last = p - i;
+    cat = 6;
+    code = 44;
+    goto done;
+s8:
+    last = p - i;
+    cat = 6;
+    code = 45;
+    goto done;
+s9:
+    last = p - i;
+    cat = 6;
+    code = 46;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s54;
+    default:
+        goto done;
+    }
+s10:
+    last = p - i;
+    cat = 6;
+    code = 65;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 43:
+        p++;
+        goto s55;
+    case 61:
+        p++;
+        goto s56;
+    default:
+        goto done;
+    }
+s11:
+    last = p - i;
+    cat = 6;
+    code = 48;
+    goto done;
+s12:
+    last = p - i;
+    cat = 6;
+    code = 33;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 45:
+        p++;
+        goto s57;
+    case 61:
+        p++;
+        goto s58;
+    case 62:
+        p++;
+        goto s59;
+    default:
+        goto done;
+    }
+s13:
+    last = p - i;
+    cat = 6;
+    code = 49;
+    goto done;
+s14:
+    last = p - i;
+    cat = 6;
+    code = 50;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 42:
+        p++;
+        goto s60;
+    case 47:
+        p++;
+        goto s61;
+    case 61:
+        p++;
+        goto s62;
+    default:
+        goto done;
+    }
+s15:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57:
+        p++;
+        goto s16;
+    case 46:
+        p++;
+        goto s63;
+    case 69: case 101:
+        p++;
+        goto s64;
+    case 70: case 102:
+        p++;
+        goto s65;
+    case 76:
+        p++;
+        goto s66;
+    case 85: case 117:
+        p++;
+        goto s67;
+    case 88: case 120:
+        p++;
+        goto s68;
+    case 108:
+        p++;
+        goto s69;
+    default:
+        goto done;
+    }
+s16:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57:
+        p++;
+        goto s16;
+    case 46:
+        p++;
+        goto s63;
+    case 69: case 101:
+        p++;
+        goto s64;
+    case 70: case 102:
+        p++;
+        goto s65;
+    case 76:
+        p++;
+        goto s66;
+    case 85: case 117:
+        p++;
+        goto s67;
+    case 108:
+        p++;
+        goto s69;
+    default:
+        goto done;
+    }
+s17:
+    last = p - i;
+    cat = 6;
+    code = 52;
+    goto done;
+s18:
+    last = p - i;
+    cat = 6;
+    code = 53;
+    goto done;
+s19:
+    last = p - i;
+    cat = 6;
+    code = 68;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 60:
+        p++;
+        goto s70;
+    case 61:
+        p++;
+        goto s71;
+    default:
+        goto done;
+    }
+s20:
+    last = p - i;
+    cat = 6;
+    code = 72;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s72;
+    default:
+        goto done;
+    }
+s21:
+    last = p - i;
+    cat = 6;
+    code = 74;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s73;
+    case 62:
+        p++;
+        goto s74;
+    default:
+        goto done;
+    }
+s22:
+    last = p - i;
+    cat = 6;
+    code = 54;
+    goto done;
+s23:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p = lex_skip(data, p + 1, LEX_SKIP[23]);
+        goto s23;
+    }
+s24:
+    last = p - i;
+    cat = 6;
+    code = 55;
+    goto done;
+s25:
+    last = p - i;
+    cat = 6;
+    code = 56;
+    goto done;
+s26:
+    last = p - i;
+    cat = 6;
+    code = 57;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s75;
+    default:
+        goto done;
+    }
+s27:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 117:
+        p++;
+        goto s76;
+    default:
+        p++;
+        goto s23;
+    }
+s28:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 114:
+        p++;
+        goto s77;
+    default:
+        p++;
+        goto s23;
+    }
+s29:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 97:
+        p++;
+        goto s78;
+    case 104:
+        p++;
+        goto s79;
+    case 111:
+        p++;
+        goto s80;
+    default:
+        p++;
+        goto s23;
+    }
+s30:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s81;
+    case 111:
+        p++;
+        goto s82;
+    default:
+        p++;
+        goto s23;
+    }
+s31:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 108:
+        p++;
+        goto s83;
+    case 110:
+        p++;
+        goto s84;
+    case 120:
+        p++;
+        goto s85;
+    default:
+        p++;
+        goto s23;
+    }
+s32:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 108:
+        p++;
+        goto s86;
+    case 111:
+        p++;
+        goto s87;
+    default:
+        p++;
+        goto s23;
+    }
+s33:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s88;
+    default:
+        p++;
+        goto s23;
+    }
+s34:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 102:
+        p++;
+        goto s89;
+    case 110:
+        p++;
+        goto s90;
+    default:
+        p++;
+        goto s23;
+    }
+s35:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s91;
+    default:
+        p++;
+        goto s23;
+    }
+s36:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s92;
+    default:
+        p++;
+        goto s23;
+    }
+s37:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 104:
+        p++;
+        goto s93;
+    case 105:
+        p++;
+        goto s94;
+    case 116:
+        p++;
+        goto s95;
+    case 119:
+        p++;
+        goto s96;
+    default:
+        p++;
+        goto s23;
+    }
+s38:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 121:
+        p++;
+        goto s97;
+    default:
+        p++;
+        goto s23;
+    }
+s39:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s98;
+    default:
+        p++;
+        goto s23;
+    }
+s40:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s99;
+    default:
+        p++;
+        goto s23;
+    }
+s41:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 104:
+        p++;
+        goto s100;
+    default:
+        p++;
+        goto s23;
+    }
+s42:
+    last = p - i;
+    cat = 6;
+    code = 59;
+    goto done;
+s43:
+    last = p - i;
+    cat = 6;
+    code = 60;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s101;
+    case 124:
+        p++;
+        goto s102;
+    default:
+        goto done;
+    }
+s44:
+    last = p - i;
+    cat = 6;
+    code = 63;
+    goto done;
+s45:
+    last = p - i;
+    cat = 6;
+    code = 64;
+    goto done;
+s46:
+    last = p - i;
+    cat = 6;
+    code = 38;
+    goto done;
+s47:
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s47;
+    case 34:
+        p++;
+        goto s48;
+    case 92:
+        p++;
+        goto s103;
+    default:
+        p = lex_skip(data, p + 1, LEX_SKIP[47]);
+        goto s47;
+    }
+s48:
+    last = p - i;
+    cat = 4;
+    code = 78;
+    goto done;
+s49:
+    last = p - i;
+    cat = 6;
+    code = 40;
+    goto done;
+s50:
+    last = p - i;
+    cat = 6;
+    code = 42;
+    goto done;
+s51:
+    last = p - i;
+    cat = 6;
+    code = 43;
+    goto done;
+s52:
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s52;
+    case 39:
+        p++;
+        goto s104;
+    default:
+        p = lex_skip(data, p + 1, LEX_SKIP[52]);
+        goto s52;
+    }
+s53:
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s52;
+    default:
+        p++;
+        goto s52;
+    }
+s54:
+    last = p - i;
+    cat = 6;
+    code = 47;
+    goto done;
+s55:
+    last = p - i;
+    cat = 6;
+    code = 66;
+    goto done;
+s56:
+    last = p - i;
+    cat = 6;
+    code = 67;
+    goto done;
+s57:
+    last = p - i;
+    cat = 6;
+    code = 34;
+    goto done;
+s58:
+    last = p - i;
+    cat = 6;
+    code = 35;
+    goto done;
+s59:
+    last = p - i;
+    cat = 6;
+    code = 36;
+    goto done;
+s60:
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s60;
+    case 42:
+        p++;
+        goto s105;
+    default:
+        p = lex_skip(data, p + 1, LEX_SKIP[60]);
+        goto s60;
+    }
+s61:
+    last = p - i;
+    cat = 7;
+    code = 79;
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s61;
+    case 10:
+        goto done;
+    default:
+        p = lex_skip(data, p + 1, LEX_SKIP[61]);
+        goto s61;
+    }
+s62:
+    last = p - i;
+    cat = 6;
+    code = 51;
+    goto done;
+s63:
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57:
+        p++;
+        goto s106;
+    default:
+        goto done;
+    }
+s64:
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 43: case 45:
+        p++;
+        goto s107;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57:
+        p++;
+        goto s108;
+    default:
+        goto done;
+    }
+s65:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    goto done;
+s66:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 85: case 117:
+        p++;
+        goto s65;
+    case 76:
+        p++;
+        goto s109;
+    default:
+        goto done;
+    }
+s67:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 76:
+        p++;
+        goto s110;
+    case 108:
+        p++;
+        goto s111;
+    default:
+        goto done;
+    }
+s68:
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70:
+    case 97: case 98: case 99: case 100: case 101: case 102:
+        p++;
+        goto s112;
+    default:
+        goto done;
+    }
+s69:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 85: case 117:
+        p++;
+        goto s65;
+    case 108:
+        p++;
+        goto s109;
+    default:
+        goto done;
+    }
+s70:
+    last = p - i;
+    cat = 6;
+    code = 69;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s113;
+    default:
+        goto done;
+    }
+s71:
+    last = p - i;
+    cat = 6;
+    code = 71;
+    goto done;
+s72:
+    last = p - i;
+    cat = 6;
+    code = 73;
+    goto done;
+s73:
+    last = p - i;
+    cat = 6;
+    code = 75;
+    goto done;
+s74:
+    last = p - i;
+    cat = 6;
+    code = 76;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 61:
+        p++;
+        goto s114;
+    default:
+        goto done;
+    }
+s75:
+    last = p - i;
+    cat = 6;
+    code = 58;
+    goto done;
+s76:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s115;
+    default:
+        p++;
+        goto s23;
+    }
+s77:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s116;
+    default:
+        p++;
+        goto s23;
+    }
+s78:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 115:
+        p++;
+        goto s117;
+    default:
+        p++;
+        goto s23;
+    }
+s79:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 97:
+        p++;
+        goto s118;
+    default:
+        p++;
+        goto s23;
+    }
+s80:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s119;
+    default:
+        p++;
+        goto s23;
+    }
+s81:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 102:
+        p++;
+        goto s120;
+    default:
+        p++;
+        goto s23;
+    }
+s82:
+    last = p - i;
+    cat = 1;
+    code = 8;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 117:
+        p++;
+        goto s121;
+    default:
+        p++;
+        goto s23;
+    }
+s83:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 115:
+        p++;
+        goto s122;
+    default:
+        p++;
+        goto s23;
+    }
+s84:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 117:
+        p++;
+        goto s123;
+    default:
+        p++;
+        goto s23;
+    }
+s85:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s124;
+    default:
+        p++;
+        goto s23;
+    }
+s86:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s125;
+    default:
+        p++;
+        goto s23;
+    }
+s87:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 114:
+        p++;
+        goto s126;
+    default:
+        p++;
+        goto s23;
+    }
+s88:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s127;
+    default:
+        p++;
+        goto s23;
+    }
+s89:
+    last = p - i;
+    cat = 1;
+    code = 16;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s90:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s128;
+    default:
+        p++;
+        goto s23;
+    }
+s91:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s129;
+    default:
+        p++;
+        goto s23;
+    }
+s92:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 103:
+        p++;
+        goto s130;
+    case 116:
+        p++;
+        goto s131;
+    default:
+        p++;
+        goto s23;
+    }
+s93:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s132;
+    default:
+        p++;
+        goto s23;
+    }
+s94:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 103:
+        p++;
+        goto s133;
+    case 122:
+        p++;
+        goto s134;
+    default:
+        p++;
+        goto s23;
+    }
+s95:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 97:
+        p++;
+        goto s135;
+    case 114:
+        p++;
+        goto s136;
+    default:
+        p++;
+        goto s23;
+    }
+s96:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s137;
+    default:
+        p++;
+        goto s23;
+    }
+s97:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 112:
+        p++;
+        goto s138;
+    default:
+        p++;
+        goto s23;
+    }
+s98:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s139;
+    case 115:
+        p++;
+        goto s140;
+    default:
+        p++;
+        goto s23;
+    }
+s99:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s141;
+    case 108:
+        p++;
+        goto s142;
+    default:
+        p++;
+        goto s23;
+    }
+s100:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s143;
+    default:
+        p++;
+        goto s23;
+    }
+s101:
+    last = p - i;
+    cat = 6;
+    code = 62;
+    goto done;
+s102:
+    last = p - i;
+    cat = 6;
+    code = 61;
+    goto done;
+s103:
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s47;
+    default:
+        p++;
+        goto s47;
+    }
+s104:
+    last = p - i;
+    cat = 5;
+    code = 77;
+    goto done;
+s105:
+    switch (data[p])
+    {
+    case 0:
+        if (p >= n)
+            goto done;
+        p++;
+        goto s60;
+    case 42:
+        p++;
+        goto s105;
+    case 47:
+        p++;
+        goto s144;
+    default:
+        p++;
+        goto s60;
+    }
+s106:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 69: case 101:
+        p++;
+        goto s64;
+    case 70: case 76: case 102: case 108:
+        p++;
+        goto s65;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57:
+        p++;
+        goto s106;
+    default:
+        goto done;
+    }
+s107:
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57:
+        p++;
+        goto s108;
+    default:
+        goto done;
+    }
+s108:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 70: case 76: case 102: case 108:
+        p++;
+        goto s65;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57:
+        p++;
+        goto s108;
+    default:
+        goto done;
+    }
+s109:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 85: case 117:
+        p++;
+        goto s65;
+    default:
+        goto done;
+    }
+s110:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 76:
+        p++;
+        goto s65;
+    default:
+        goto done;
+    }
+s111:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 108:
+        p++;
+        goto s65;
+    default:
+        goto done;
+    }
+s112:
+    last = p - i;
+    cat = 3;
+    code = 80;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 76:
+        p++;
+        goto s66;
+    case 85: case 117:
+        p++;
+        goto s67;
+    case 108:
+        p++;
+        goto s69;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+    case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70:
+    case 97: case 98: case 99: case 100: case 101: case 102:
+        p++;
+        goto s112;
+    default:
+        goto done;
+    }
+s113:
+    last = p - i;
+    cat = 6;
+    code = 70;
+    goto done;
+s114:
+    last = p - i;
+    cat = 6;
+    code = 77;
+    goto done;
+s115:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s145;
+    default:
+        p++;
+        goto s23;
+    }
+s116:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 97:
+        p++;
+        goto s146;
+    default:
+        p++;
+        goto s23;
+    }
+s117:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s147;
+    default:
+        p++;
+        goto s23;
+    }
+s118:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 114:
+        p++;
+        goto s148;
+    default:
+        p++;
+        goto s23;
+    }
+s119:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 115:
+        p++;
+        goto s149;
+    case 116:
+        p++;
+        goto s150;
+    default:
+        p++;
+        goto s23;
+    }
+s120:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 97:
+        p++;
+        goto s151;
+    default:
+        p++;
+        goto s23;
+    }
+s121:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 98:
+        p++;
+        goto s152;
+    default:
+        p++;
+        goto s23;
+    }
+s122:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s153;
+    default:
+        p++;
+        goto s23;
+    }
+s123:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 109:
+        p++;
+        goto s154;
+    default:
+        p++;
+        goto s23;
+    }
+s124:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s155;
+    default:
+        p++;
+        goto s23;
+    }
+s125:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 97:
+        p++;
+        goto s156;
+    default:
+        p++;
+        goto s23;
+    }
+s126:
+    last = p - i;
+    cat = 1;
+    code = 14;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s127:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s157;
+    default:
+        p++;
+        goto s23;
+    }
+s128:
+    last = p - i;
+    cat = 1;
+    code = 17;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s129:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 103:
+        p++;
+        goto s158;
+    default:
+        p++;
+        goto s23;
+    }
+s130:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s159;
+    default:
+        p++;
+        goto s23;
+    }
+s131:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 117:
+        p++;
+        goto s160;
+    default:
+        p++;
+        goto s23;
+    }
+s132:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 114:
+        p++;
+        goto s161;
+    default:
+        p++;
+        goto s23;
+    }
+s133:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s162;
+    default:
+        p++;
+        goto s23;
+    }
+s134:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s163;
+    default:
+        p++;
+        goto s23;
+    }
+s135:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s164;
+    default:
+        p++;
+        goto s23;
+    }
+s136:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 117:
+        p++;
+        goto s165;
+    default:
+        p++;
+        goto s23;
+    }
+s137:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s166;
+    default:
+        p++;
+        goto s23;
+    }
+s138:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s167;
+    default:
+        p++;
+        goto s23;
+    }
+s139:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s168;
+    default:
+        p++;
+        goto s23;
+    }
+s140:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s169;
+    default:
+        p++;
+        goto s23;
+    }
+s141:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 100:
+        p++;
+        goto s170;
+    default:
+        p++;
+        goto s23;
+    }
+s142:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 97:
+        p++;
+        goto s171;
+    default:
+        p++;
+        goto s23;
+    }
+s143:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 108:
+        p++;
+        goto s172;
+    default:
+        p++;
+        goto s23;
+    }
+s144:
+    last = p - i;
+    cat = 8;
+    code = 79;
+    goto done;
+s145:
+    last = p - i;
+    cat = 1;
+    code = 1;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s146:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 107:
+        p++;
+        goto s173;
+    default:
+        p++;
+        goto s23;
+    }
+s147:
+    last = p - i;
+    cat = 1;
+    code = 3;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s148:
+    last = p - i;
+    cat = 1;
+    code = 4;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s149:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s174;
+    default:
+        p++;
+        goto s23;
+    }
+s150:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s175;
+    default:
+        p++;
+        goto s23;
+    }
+s151:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 117:
+        p++;
+        goto s176;
+    default:
+        p++;
+        goto s23;
+    }
+s152:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 108:
+        p++;
+        goto s177;
+    default:
+        p++;
+        goto s23;
+    }
+s153:
+    last = p - i;
+    cat = 1;
+    code = 10;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s154:
+    last = p - i;
+    cat = 1;
+    code = 11;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s155:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 114:
+        p++;
+        goto s178;
+    default:
+        p++;
+        goto s23;
+    }
+s156:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s179;
+    default:
+        p++;
+        goto s23;
+    }
+s157:
+    last = p - i;
+    cat = 1;
+    code = 15;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s158:
+    last = p - i;
+    cat = 1;
+    code = 18;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s159:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 115:
+        p++;
+        goto s180;
+    default:
+        p++;
+        goto s23;
+    }
+s160:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 114:
+        p++;
+        goto s181;
+    default:
+        p++;
+        goto s23;
+    }
+s161:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s182;
+    default:
+        p++;
+        goto s23;
+    }
+s162:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s183;
+    default:
+        p++;
+        goto s23;
+    }
+s163:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 111:
+        p++;
+        goto s184;
+    default:
+        p++;
+        goto s23;
+    }
+s164:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s185;
+    default:
+        p++;
+        goto s23;
+    }
+s165:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 99:
+        p++;
+        goto s186;
+    default:
+        p++;
+        goto s23;
+    }
+s166:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 99:
+        p++;
+        goto s187;
+    default:
+        p++;
+        goto s23;
+    }
+s167:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 100:
+        p++;
+        goto s188;
+    default:
+        p++;
+        goto s23;
+    }
+s168:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s189;
+    default:
+        p++;
+        goto s23;
+    }
+s169:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 103:
+        p++;
+        goto s190;
+    default:
+        p++;
+        goto s23;
+    }
+s170:
+    last = p - i;
+    cat = 1;
+    code = 30;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s171:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s191;
+    default:
+        p++;
+        goto s23;
+    }
+s172:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s192;
+    default:
+        p++;
+        goto s23;
+    }
+s173:
+    last = p - i;
+    cat = 1;
+    code = 2;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s174:
+    last = p - i;
+    cat = 1;
+    code = 5;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s175:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s193;
+    default:
+        p++;
+        goto s23;
+    }
+s176:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 108:
+        p++;
+        goto s194;
+    default:
+        p++;
+        goto s23;
+    }
+s177:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s195;
+    default:
+        p++;
+        goto s23;
+    }
+s178:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s196;
+    default:
+        p++;
+        goto s23;
+    }
+s179:
+    last = p - i;
+    cat = 1;
+    code = 13;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s180:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s197;
+    default:
+        p++;
+        goto s23;
+    }
+s181:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s198;
+    default:
+        p++;
+        goto s23;
+    }
+s182:
+    last = p - i;
+    cat = 1;
+    code = 21;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s183:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 100:
+        p++;
+        goto s199;
+    default:
+        p++;
+        goto s23;
+    }
+s184:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 102:
+        p++;
+        goto s200;
+    default:
+        p++;
+        goto s23;
+    }
+s185:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 99:
+        p++;
+        goto s201;
+    default:
+        p++;
+        goto s23;
+    }
+s186:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s202;
+    default:
+        p++;
+        goto s23;
+    }
+s187:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 104:
+        p++;
+        goto s203;
+    default:
+        p++;
+        goto s23;
+    }
+s188:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s204;
+    default:
+        p++;
+        goto s23;
+    }
+s189:
+    last = p - i;
+    cat = 1;
+    code = 28;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s190:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 110:
+        p++;
+        goto s205;
+    default:
+        p++;
+        goto s23;
+    }
+s191:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 105:
+        p++;
+        goto s206;
+    default:
+        p++;
+        goto s23;
+    }
+s192:
+    last = p - i;
+    cat = 1;
+    code = 32;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s193:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 117:
+        p++;
+        goto s207;
+    default:
+        p++;
+        goto s23;
+    }
+s194:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 116:
+        p++;
+        goto s208;
+    default:
+        p++;
+        goto s23;
+    }
+s195:
+    last = p - i;
+    cat = 1;
+    code = 9;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s196:
+    last = p - i;
+    cat = 1;
+    code = 12;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s197:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s209;
+    default:
+        p++;
+        goto s23;
+    }
+s198:
+    last = p - i;
+    cat = 1;
+    code = 20;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s199:
+    last = p - i;
+    cat = 1;
+    code = 22;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s200:
+    last = p - i;
+    cat = 1;
+    code = 23;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s201:
+    last = p - i;
+    cat = 1;
+    code = 24;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s202:
+    last = p - i;
+    cat = 1;
+    code = 25;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s203:
+    last = p - i;
+    cat = 1;
+    code = 26;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s204:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 102:
+        p++;
+        goto s210;
+    default:
+        p++;
+        goto s23;
+    }
+s205:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s211;
+    default:
+        p++;
+        goto s23;
+    }
+s206:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 108:
+        p++;
+        goto s212;
+    default:
+        p++;
+        goto s23;
+    }
+s207:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s213;
+    default:
+        p++;
+        goto s23;
+    }
+s208:
+    last = p - i;
+    cat = 1;
+    code = 7;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s209:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 114:
+        p++;
+        goto s214;
+    default:
+        p++;
+        goto s23;
+    }
+s210:
+    last = p - i;
+    cat = 1;
+    code = 27;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s211:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 100:
+        p++;
+        goto s215;
+    default:
+        p++;
+        goto s23;
+    }
+s212:
+    last = p - i;
+    cat = 2;
+    code = 81;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    case 101:
+        p++;
+        goto s216;
+    default:
+        p++;
+        goto s23;
+    }
+s213:
+    last = p - i;
+    cat = 1;
+    code = 6;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s214:
+    last = p - i;
+    cat = 1;
+    code = 19;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s215:
+    last = p - i;
+    cat = 1;
+    code = 29;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+s216:
+    last = p - i;
+    cat = 1;
+    code = 31;
+    switch (data[p])
+    {
+    case 0:
+        goto done;
+    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 58:
+    case 59: case 60: case 61: case 62: case 63: case 64: case 91: case 92:
+    case 93: case 94: case 96: case 123: case 124: case 125: case 126: case 127:
+        goto done;
+    default:
+        p++;
+        goto s23;
+    }
+done:
+    stop = p;
+    return last;
+}
+#endif
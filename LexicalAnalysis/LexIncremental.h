@@ -0,0 +1,280 @@
+// 增量词法分析：缓冲区被编辑后，从编辑处之前最近的、不受影响的记号边界（DFA 回到初态 0 处）重新扫描，
+// 直到新的记号序列与旧序列在同一位置开始记号为止；之后的旧记号不再扫描，只平移偏移
+#ifndef LEX_INCREMENTAL_H
+#define LEX_INCREMENTAL_H
+#include "LexAnalysis.h"
+#include <algorithm>
+
+// 记号序列中的一项；相邻两项首尾相接（空白与无法匹配而跳过的字节也各占一项），
+// 本项的结束位置即下一项的起点
+struct IncToken
+{
+    uint64_t pos;  // 起点相对所在块 base 的偏移
+    uint16_t kind; // 记号类别 CAT_*，0 表示无法匹配而跳过的一个字节
+    uint16_t code;
+    uint32_t look; // DFA 在记号结束后又多读了几个字节（读到 end + look 为止），不会小于真实值；INC_LOOK_END 表示读到末尾
+};
+
+const uint32_t INC_LOOK_END = UINT32_MAX;
+
+// 记号按块存放，编辑只重建受影响的一两块，其后各块只把 base 加上长度变化量
+const size_t INC_BLOCK = 1024;
+
+struct IncBlock
+{
+    uint64_t base; // 块内第一项的起点
+    size_t far;    // 块内 look 超过 LEX_MEMO_MIN 的项数，通常只来自未闭合的注释、字符串
+    vector<IncToken> toks;
+};
+
+class IncrementalLexer
+{
+public:
+    IncrementalLexer() : data(""), n(0), count(0), far(0), stale(0) {}
+
+    // 完整扫描 data[0, n)，data[n] 须为 '\0'
+    void lex(const char *src, size_t len)
+    {
+        data = src;
+        n = len;
+        blocks.clear();
+        count = far = stale = 0;
+        vector<IncToken> fresh;
+        Cursor c = {0, 0};
+        scan(0, 0, c, 0, fresh);
+        splice(c, c, fresh, 0);
+    }
+
+    // 缓冲区中 [offset, offset + removed) 被替换为 inserted 个字节，src 为编辑后的缓冲区（src[len] 须为 '\0'），
+    // 由调用者持有；返回重新扫描的记号数
+    size_t edit(const char *src, size_t len, size_t offset, size_t removed, size_t inserted)
+    {
+        Cursor from = restart(offset);
+        Cursor old = first_at_or_after(offset + removed); // 第一个在被删除区间之后开始的旧记号
+        uint64_t start = valid(from) ? offset_at(from) : 0; // 在编辑处之前，新旧偏移相同
+        uint64_t delta = inserted - removed;                 // 按无符号数回绕相加即可
+
+        data = src;
+        n = len;
+        vector<IncToken> fresh;
+        scan(start, offset + inserted, old, delta, fresh);
+        splice(from, old, fresh, delta);
+        return fresh.size();
+    }
+
+    size_t size() const { return count; }
+
+    uint64_t offset(size_t i) const { return offset_at(cursor(i)); }
+
+    // 第 i 项的记号，text 指向当前缓冲区；kind 为 0 或 CAT_WHITESPACE 的项不输出
+    Token token(size_t i) const
+    {
+        Cursor c = cursor(i);
+        const IncToken &t = blocks[c.b].toks[c.i];
+        Token tok;
+        tok.kind = t.kind;
+        tok.code = t.code;
+        tok.offset = offset_at(c);
+        tok.sym = SYM_NONE;
+        decode_number(tok);
+        tok.text = string_view(data + tok.offset, end_at(c) - tok.offset);
+        return tok;
+    }
+
+private:
+    struct Cursor
+    {
+        size_t b, i; // 第 b 块第 i 项
+    };
+
+    const char *data;
+    size_t n;
+    vector<IncBlock> blocks;
+    size_t count, far; // 总项数、各块 far 之和
+    // starts[b]：前 b + 1 块的项数之和，编辑时不更新，按下标取记号时才从第 stale 块起重新累加
+    mutable vector<size_t> starts;
+    mutable size_t stale;
+
+    bool valid(Cursor c) const { return c.b < blocks.size(); }
+
+    void advance(Cursor &c) const
+    {
+        if (++c.i == blocks[c.b].toks.size())
+        {
+            c.b++;
+            c.i = 0;
+        }
+    }
+
+    bool retreat(Cursor &c) const
+    {
+        if (c.i > 0)
+            c.i--;
+        else if (c.b > 0)
+            c.i = blocks[--c.b].toks.size() - 1;
+        else
+            return false;
+        return true;
+    }
+
+    uint64_t offset_at(Cursor c) const { return blocks[c.b].base + blocks[c.b].toks[c.i].pos; }
+
+    uint64_t end_at(Cursor c) const
+    {
+        advance(c);
+        return valid(c) ? offset_at(c) : n;
+    }
+
+    uint64_t reach_at(Cursor c) const
+    {
+        uint32_t look = blocks[c.b].toks[c.i].look;
+        return look == INC_LOOK_END ? UINT64_MAX : end_at(c) + look;
+    }
+
+    Cursor cursor(size_t i) const
+    {
+        starts.resize(blocks.size());
+        for (; stale < blocks.size(); stale++)
+            starts[stale] = (stale ? starts[stale - 1] : 0) + blocks[stale].toks.size();
+        size_t b = upper_bound(starts.begin(), starts.end(), i) - starts.begin();
+        Cursor c = {b, i - (b ? starts[b - 1] : 0)};
+        return c;
+    }
+
+    // 起点不超过 pos 的最后一项（没有记号时为末尾）
+    Cursor last_at_or_before(uint64_t pos) const
+    {
+        Cursor c = {0, 0};
+        if (blocks.empty())
+            return c;
+        vector<IncBlock>::const_iterator it = upper_bound(blocks.begin() + 1, blocks.end(), pos,
+                                                          [](uint64_t p, const IncBlock &blk) { return p < blk.base; });
+        c.b = it - blocks.begin() - 1;
+        const vector<IncToken> &t = blocks[c.b].toks;
+        uint64_t rel = pos - blocks[c.b].base;
+        c.i = upper_bound(t.begin() + 1, t.end(), rel, [](uint64_t p, const IncToken &x) { return p < x.pos; }) - t.begin() - 1;
+        return c;
+    }
+
+    // 起点不小于 pos 的第一项，没有则为末尾
+    Cursor first_at_or_after(uint64_t pos) const
+    {
+        Cursor c = last_at_or_before(pos);
+        if (valid(c) && offset_at(c) < pos)
+            advance(c);
+        return c;
+    }
+
+    // 编辑从 offset 开始时需要重扫的第一项：包含 offset - 1 的记号，再往前凡是 DFA 读到过 offset 处的记号也要重扫
+    // 普通记号的 look 不超过 LEX_MEMO_MIN，往回看这么远即可；多读很远的记号很少，按块的计数找出来逐个检查
+    Cursor restart(size_t offset) const
+    {
+        Cursor first = {0, 0};
+        if (offset == 0 || blocks.empty())
+            return first;
+        first = last_at_or_before(offset - 1);
+        for (Cursor c = first; retreat(c) && end_at(c) + LEX_MEMO_MIN >= offset;)
+            if (reach_at(c) >= offset)
+                first = c;
+        for (size_t b = 0; far > 0 && b <= first.b; b++)
+        {
+            if (blocks[b].far == 0)
+                continue;
+            for (Cursor c = {b, 0}; c.b == b && (b < first.b || c.i < first.i); advance(c))
+                if (blocks[b].toks[c.i].look > LEX_MEMO_MIN && reach_at(c) >= offset)
+                    return c;
+        }
+        return first;
+    }
+
+    // 从 from 开始扫描当前缓冲区，新记号（pos 为绝对偏移）追加到 fresh；old 指向尚未越过的旧记号，
+    // 其偏移加上 delta 即为新偏移。扫描到 resume 及其后、恰好落在某个旧记号的起点时停下，old 指向该记号，
+    // 此后新旧序列完全相同；扫到末尾时 old 为末尾
+    void scan(uint64_t from, uint64_t resume, Cursor &old, uint64_t delta, vector<IncToken> &fresh)
+    {
+        const unsigned char *src = (const unsigned char *)data;
+        MunchMemo memo;
+        size_t pos = from;
+        while (pos < n)
+        {
+            while (valid(old) && offset_at(old) + delta < pos)
+                advance(old);
+            if (pos >= resume && valid(old) && offset_at(old) + delta == pos)
+                return;
+            int cat = 0, code = 0;
+            size_t stop;
+            size_t len = memo.longest(src, pos, n, cat, code, stop);
+            size_t end = pos + (len ? len : 1);
+            IncToken t;
+            t.pos = pos;
+            t.kind = len ? cat : 0;
+            t.code = code;
+            t.look = stop < end ? 0 : stop - end >= INC_LOOK_END ? INC_LOOK_END : stop - end;
+            fresh.push_back(t);
+            pos = end;
+        }
+        old.b = blocks.size();
+        old.i = 0;
+    }
+
+    // 用 fresh 替换 [from, to) 之间的旧记号，to 及之后的旧记号偏移加上 delta；
+    // 只重建 from、to 所在的块，其后各块只改 base
+    void splice(Cursor from, Cursor to, const vector<IncToken> &fresh, uint64_t delta)
+    {
+        vector<IncToken> merged; // 绝对偏移
+        for (size_t i = 0; valid(from) && i < from.i; i++)
+            merged.push_back(absolute(from.b, i, 0));
+        merged.insert(merged.end(), fresh.begin(), fresh.end());
+        size_t last = to.b; // 被替换的块为 [from.b, last)
+        if (valid(to) && to.i > 0)
+        {
+            for (size_t i = to.i; i < blocks[to.b].toks.size(); i++)
+                merged.push_back(absolute(to.b, i, delta));
+            last++;
+        }
+        for (size_t b = last; b < blocks.size(); b++)
+            blocks[b].base += delta;
+
+        size_t b0 = min(from.b, blocks.size());
+        for (size_t b = b0; b < last; b++)
+        {
+            count -= blocks[b].toks.size();
+            far -= blocks[b].far;
+        }
+        count += merged.size();
+
+        vector<IncBlock> built;
+        for (size_t i = 0; i < merged.size();)
+        {
+            size_t k = merged.size() - i < 2 * INC_BLOCK ? merged.size() - i : INC_BLOCK;
+            IncBlock blk;
+            blk.base = merged[i].pos;
+            blk.far = 0;
+            blk.toks.assign(merged.begin() + i, merged.begin() + i + k);
+            for (IncToken &t : blk.toks)
+            {
+                t.pos -= blk.base;
+                blk.far += t.look > LEX_MEMO_MIN;
+            }
+            far += blk.far;
+            built.push_back(move(blk));
+            i += k;
+        }
+        if (built.size() == last - b0)
+            move(built.begin(), built.end(), blocks.begin() + b0); // 块数不变时原地替换，不挪动其后的块
+        else
+        {
+            blocks.erase(blocks.begin() + b0, blocks.begin() + last);
+            blocks.insert(blocks.begin() + b0, make_move_iterator(built.begin()), make_move_iterator(built.end()));
+        }
+        stale = min(stale, b0);
+    }
+
+    IncToken absolute(size_t b, size_t i, uint64_t delta) const
+    {
+        IncToken t = blocks[b].toks[i];
+        t.pos += blocks[b].base + delta;
+        return t;
+    }
+};
+#endif
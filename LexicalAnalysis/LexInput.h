@@ -0,0 +1,147 @@
+// 词法分析器的输入缓冲：文件用 mmap 直接映射，标准输入一次性整块读入
+// 无论哪种方式，缓冲区 data()[size()] 处都保证是 '\0' 哨兵，可直接交给 scan()
+#ifndef LEX_INPUT_H
+#define LEX_INPUT_H
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <fstream>
+#include <sstream>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+using namespace std;
+
+class SourceBuffer
+{
+public:
+    SourceBuffer() : ptr(""), len(0), map_base(NULL), map_len(0) {}
+    ~SourceBuffer() { release(); }
+
+    const char *data() const { return ptr; }
+    size_t size() const { return len; }
+
+    // 打开并映射文件，失败返回 false
+    bool open_file(const char *path)
+    {
+        release();
+#if !defined(_WIN32)
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            // 管道、设备等无法映射，按流整块读入
+            bool ok = read_fd(fd);
+            ::close(fd);
+            return ok;
+        }
+
+        size_t file_len = st.st_size;
+        long page = sysconf(_SC_PAGESIZE);
+        // 文件长度不是页大小的整数倍时，映射的最后一页在文件末尾之后由内核补 0，天然带哨兵；
+        // 恰好整页（含空文件）时末尾之后没有可读的字节，只能复制到自有缓冲区
+        if (file_len % page != 0)
+        {
+            void *p = mmap(NULL, file_len, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED)
+            {
+                ::close(fd);
+                map_base = p;
+                map_len = file_len;
+                ptr = (const char *)p;
+                len = file_len;
+                return true;
+            }
+        }
+        bool ok = read_fd(fd);
+        ::close(fd);
+        return ok;
+#else
+        ifstream in(path, ios::binary);
+        if (!in)
+            return false;
+        read_stream(in);
+        return true;
+#endif
+    }
+
+    // 读入标准输入
+    void read_stdin()
+    {
+        release();
+#if !defined(_WIN32)
+        read_fd(0);
+#else
+        read_stream(cin);
+#endif
+    }
+
+    void read_stream(istream &in)
+    {
+        release();
+        ostringstream ss;
+        ss << in.rdbuf();
+        owned = ss.str();
+        ptr = owned.c_str();
+        len = owned.size();
+    }
+
+private:
+    const char *ptr;
+    size_t len;
+    void *map_base;
+    size_t map_len;
+    string owned; // 非映射时的自有缓冲区，c_str() 末尾自带 '\0'
+
+    void release()
+    {
+#if !defined(_WIN32)
+        if (map_base)
+            munmap(map_base, map_len);
+#endif
+        map_base = NULL;
+        map_len = 0;
+        owned.clear();
+        ptr = "";
+        len = 0;
+    }
+
+#if !defined(_WIN32)
+    // 按大块 read(2) 读到文件末尾，不逐字节处理
+    bool read_fd(int fd)
+    {
+        owned.clear();
+        size_t used = 0;
+        owned.resize(1 << 16);
+        while (true)
+        {
+            if (used == owned.size())
+                owned.resize(owned.size() * 2);
+            ssize_t got = ::read(fd, &owned[used], owned.size() - used);
+            if (got < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            if (got == 0)
+                break;
+            used += got;
+        }
+        owned.resize(used);
+        ptr = owned.c_str();
+        len = used;
+        return true;
+    }
+#endif
+
+    SourceBuffer(const SourceBuffer &);
+    SourceBuffer &operator=(const SourceBuffer &);
+};
+#endif
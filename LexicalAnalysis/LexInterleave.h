@@ -0,0 +1,266 @@
+// 多路交错扫描：一次 DFA 匹配是一串前后依赖的查表，单路扫描时每一步都要等上一步的表项读回来，
+// 核心的访存能力大半闲置。这里在同一个循环里让 K 路互不相关的输入（不同的文件）各走一步，
+// 各路的查表没有依赖，可以同时在途，用来掩盖查表的延迟；每一路的记号与 Lexer 逐个相同
+#ifndef LEX_INTERLEAVE_H
+#define LEX_INTERLEAVE_H
+#include "LexAnalysis.h"
+#include <utility>
+
+// 交错分析多个输入，每个输入的记号依次推给各自的 sink，与 Lexer<Sink>(sink, data, n).run() 相同
+// 同时扫描 K 路（编译期确定，循环完全展开），一路扫完即接着扫下一个尚未开始的输入；
+// 各输入的缓冲区须满足 data[n] == '\0'，且在 run() 期间保持有效
+// 交错的循环逐字节查表，不做自环的 SIMD 跳过，长注释、长字符串多的输入不如单路的 Lexer
+template <typename Sink = NullSink, int K = 4>
+class InterleavedLexer
+{
+    static_assert(K >= 1 && K <= 256, "lane index is stored in 8 bits");
+
+public:
+    // 加入一个输入，返回其编号，run() 之后由 sink(编号) 取回其中的结果
+    size_t add(const char *data, size_t n, const Sink &sink = Sink())
+    {
+        Input in = {data, n};
+        inputs.push_back(in);
+        sinks.push_back(sink);
+        return inputs.size() - 1;
+    }
+
+    size_t size() const { return inputs.size(); }
+
+    Sink &sink(size_t i) { return sinks[i]; }
+
+    // 分析全部输入
+    void run()
+    {
+        next_input = 0;
+        Lane lanes[K];
+        int live = 0;
+        for (int k = 0; k < K; k++)
+            live += refill(lanes[k]);
+
+        // 各路正在进行的匹配放在局部数组中：从 start 开始，下一个读 *p，DFA 在状态 curr，
+        // 目前最长的匹配到 matched 为止、接收状态为 accept（尚未接收时 matched == start、accept 为 0）
+        const unsigned char *start[K], *p[K], *matched[K];
+        int curr[K], accept[K];
+        for (int k = 0; k < K; k++)
+            load(lanes[k], start[k], p[k], curr[k], accept[k], matched[k]);
+
+        // 攒下的匹配：各路共用，按停下的先后排列，每一路自己的记号仍按顺序
+        const unsigned char *ends[BATCH];
+        uint32_t tags[BATCH]; // 接收状态 << 8 | 第几路
+        int count = 0;
+
+        // 每一路走一步；k 是编译期常量，展开后各路的状态数组都拆成单个变量，留在寄存器中
+        auto step = [&](auto lane) {
+            const int k = decltype(lane)::value;
+            // DFA 停下时只记下匹配的结束处与接收状态，攒够一批再由 flush() 推给 sink：构造记号、解码常数都不在这个循环里，
+            // 循环体小到各路状态都能留在寄存器中。读到 '\0'（末尾哨兵、源码中的 '\0'、空闲的一路）或读过头太多时交给 finish()
+            const unsigned char *q = p[k];
+            lex_state_t next = LEX_TRANS[curr[k]][LEX_BYTE_CLASS[*q]];
+            if (next != LEX_NONE)
+            {
+                curr[k] = next;
+                if (LEX_ACCEPT[next] > 0)
+                {
+                    accept[k] = next;
+                    matched[k] = q + 1;
+                }
+                p[k] = q + 1;
+                return;
+            }
+            if (*q == 0 || (size_t)(q - matched[k]) > LEX_MEMO_MIN)
+            {
+                Lane &l = lanes[k];
+                store(l, start[k], q, curr[k], accept[k], matched[k]);
+                if (l.input != (size_t)-1)
+                {
+                    flush(lanes, ends, tags, count); // finish() 直接推出记号，这一路攒下的须先推完
+                    count = 0;
+                }
+                live -= finish(l);
+                load(l, start[k], p[k], curr[k], accept[k], matched[k]);
+                return;
+            }
+
+            ends[count] = matched[k];
+            tags[count] = accept[k] << 8 | k;
+            if (++count == BATCH)
+            {
+                flush(lanes, ends, tags, count);
+                count = 0;
+            }
+            start[k] = p[k] = matched[k] + (matched[k] == start[k]); // 无匹配时跳过一个字节
+            matched[k] = start[k];
+            curr[k] = accept[k] = 0;
+        };
+        while (live > 0)
+            each_lane(step, make_integer_sequence<int, K>());
+        flush(lanes, ends, tags, count);
+    }
+
+private:
+    struct Input
+    {
+        const char *data;
+        size_t n;
+    };
+
+    static const int BATCH = 256;
+
+    struct Lane
+    {
+        const unsigned char *src;
+        size_t n;
+        size_t input; // 输入编号，空闲时为 -1
+        size_t start, p, matched;
+        int curr, accept;
+        size_t emitted; // 攒下的匹配推到了哪里，即下一个待推出的匹配的起点
+        MunchMemo memo;
+    };
+
+    vector<Input> inputs;
+    vector<Sink> sinks;
+    size_t next_input;
+
+    // 依次以编译期常量 0, 1, ..., K - 1 调用 f
+    template <typename F, int... I>
+    static void each_lane(F &f, integer_sequence<int, I...>)
+    {
+        (f(integral_constant<int, I>()), ...);
+    }
+
+    // 空闲的一路停在这里：'\0' 在转移表中无转移，每一步都立即进入 finish()
+    static const unsigned char *idle()
+    {
+        static const unsigned char nul[1] = {0};
+        return nul;
+    }
+
+    // 在 Lane 中的偏移与循环中的指针之间互相换算
+    static void load(const Lane &l, const unsigned char *&start, const unsigned char *&p, int &curr, int &accept,
+                     const unsigned char *&matched)
+    {
+        start = l.src + l.start;
+        p = l.src + l.p;
+        curr = l.curr;
+        accept = l.accept;
+        matched = l.src + l.matched;
+    }
+
+    static void store(Lane &l, const unsigned char *start, const unsigned char *p, int curr, int accept,
+                      const unsigned char *matched)
+    {
+        l.start = start - l.src;
+        l.p = p - l.src;
+        l.curr = curr;
+        l.accept = accept;
+        l.matched = matched - l.src;
+    }
+
+    static void reset(Lane &l)
+    {
+        l.p = l.matched = l.emitted = l.start;
+        l.curr = l.accept = 0;
+    }
+
+    // 接着扫下一个尚未开始的输入，没有则空闲；返回这一路是否仍在扫描
+    bool refill(Lane &l)
+    {
+        while (next_input < inputs.size())
+        {
+            l.input = next_input++;
+            l.src = (const unsigned char *)inputs[l.input].data;
+            l.n = inputs[l.input].n;
+            l.start = 0;
+            l.memo = MunchMemo();
+            if (l.n > 0)
+            {
+                reset(l);
+                return true;
+            }
+        }
+        l.input = (size_t)-1;
+        l.src = idle();
+        l.n = 0;
+        l.start = 0;
+        reset(l);
+        return false;
+    }
+
+    // DFA 在 l.p 处无转移：处理源码中真实的 '\0'，或结束这次匹配、推出记号并开始下一次；
+    // 返回这一路是否由此变为空闲。finish()、flush() 都不内联，免得撑大 run() 的循环体
+    __attribute__((noinline)) bool finish(Lane &l)
+    {
+        if (l.input == (size_t)-1)
+            return false;
+        if (l.src[l.p] == 0 && l.p < l.n)
+        {
+            lex_state_t next = LEX_NUL_TRANS[l.curr];
+            if (next != LEX_NONE)
+            {
+                l.curr = next;
+                if (LEX_ACCEPT[next] > 0)
+                {
+                    l.accept = next;
+                    l.matched = l.p + 1;
+                }
+                l.p++;
+                return false;
+            }
+        }
+
+        // 与 MunchMemo::longest() 相同：DFA 读过头太多时改用备忘录重新匹配，之后落在该区域内的匹配都走 match()
+        size_t len = l.matched - l.start;
+        int cat = LEX_ACCEPT[l.accept], code = LEX_CODE[l.accept];
+        size_t stop;
+        if (l.p - l.matched > LEX_MEMO_MIN)
+        {
+            l.memo.open(l.start);
+            len = l.memo.match(l.src, l.start, l.n, cat, code, stop);
+        }
+        emit(l, l.start, len, cat, code);
+        l.start += len ? len : 1;
+        while (l.start < l.n && l.memo.covers(l.start))
+        {
+            len = l.memo.match(l.src, l.start, l.n, cat, code, stop);
+            emit(l, l.start, len, cat, code);
+            l.start += len ? len : 1;
+        }
+        if (l.start < l.n)
+        {
+            reset(l);
+            return false;
+        }
+        return !refill(l);
+    }
+
+    // 把攒下的匹配依次推给各自的 sink；同一路的匹配首尾相接，起点即上一个匹配的结束处
+    // 各路换到下一个输入之前都会经过 finish()，攒下的匹配总是属于各路当前的输入
+    __attribute__((noinline)) void flush(Lane *lanes, const unsigned char *const *ends, const uint32_t *tags, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            Lane &l = lanes[tags[i] & 0xFF];
+            int accept = tags[i] >> 8;
+            size_t end = ends[i] - l.src;
+            emit(l, l.emitted, end - l.emitted, LEX_ACCEPT[accept], LEX_CODE[accept]);
+            l.emitted = end > l.emitted ? end : l.emitted + 1;
+        }
+    }
+
+    // 推出从 start 开始、长 len 的记号；与 Lexer::next() 相同，空白与无法匹配的字节不推出
+    void emit(const Lane &l, size_t start, size_t len, int cat, int code)
+    {
+        if (len == 0 || cat == CAT_WHITESPACE)
+            return;
+        Token tok;
+        tok.kind = cat;
+        tok.code = code;
+        tok.text = string_view((const char *)l.src + start, len);
+        tok.offset = start;
+        tok.sym = SYM_NONE;
+        decode_number(tok);
+        sinks[l.input].onToken(tok);
+    }
+};
+#endif
@@ -0,0 +1,264 @@
+// 单个文件的并行词法分析：把缓冲区切成若干块，每块在自己的线程上推测性地扫描，
+// 再用一趟线性的拼接按前一块真实的结束位置挑出一致的记号序列，输出与顺序的 scan() 完全相同
+#ifndef LEX_PARALLEL_H
+#define LEX_PARALLEL_H
+#include "LexAnalysis.h"
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+// 记号序列中的一项；相邻两项首尾相接，本项的结束位置即下一项的 offset
+// kind 为 0 表示无法匹配而跳过的一个字节
+struct ChunkToken
+{
+    uint64_t offset;
+    uint16_t kind;
+    uint16_t code;
+};
+
+// 从某个起点开始连续扫描得到的记号序列，覆盖 [toks[0].offset, end)
+struct LexRun
+{
+    vector<ChunkToken> toks;
+    uint64_t end;
+    size_t merge; // 与块的主序列汇合时，汇合处在主序列中的下标；未汇合为 -1
+};
+
+class ParallelLexer
+{
+public:
+    // 每轮 threads 块，每块约 chunk 字节；各线程的缓冲区逐轮复用，内存占用与文件大小无关
+    ParallelLexer(const char *data, size_t n, int threads, size_t chunk = 1 << 20)
+        : data(data), n(n), threads(threads < 1 ? 1 : threads), chunk(chunk < 4096 ? 4096 : chunk),
+          slots(this->threads) {}
+
+    // 输出全部记号，与 scan(data, n) 的输出逐字节相同
+    void run()
+    {
+        split();
+        int k_count = bounds.size() - 1;
+        uint64_t at = 0; // 真实记号序列进入下一块的位置
+        for (int w = 0; w < k_count; w += threads)
+        {
+            int m = min(threads, k_count - w);
+            parallel_for(m, [&](int s) { speculate(w + s, slots[s]); });
+            for (int s = 0; s < m; s++)
+                at = stitch(w + s, slots[s], at);
+
+            // 各块的记号序号依次接续，格式化可以并行进行，再按块的顺序写出
+            parallel_for(m, [&](int s) { slots[s].printed = printed_count(slots[s]); });
+            long long first = tokenCount;
+            for (int s = 0; s < m; s++)
+            {
+                slots[s].first = first;
+                first += slots[s].printed;
+            }
+            parallel_for(m, [&](int s) {
+                Slot &slot = slots[s];
+                slot.out.clear();
+                slot.out.set_tsv(tokenOut.tsv());
+                long long count = slot.first;
+                for_each_token(slot, [&](const Token &tok) { printToken(slot.out, count, tok); });
+            });
+            for (int s = 0; s < m; s++)
+                tokenOut.put(slots[s].out.contents());
+            tokenCount = first;
+        }
+        tokenOut.flush();
+    }
+
+private:
+    // 拼接后一块的记号序列由若干段组成：[begin, end) 取自某个 LexRun
+    struct Segment
+    {
+        const LexRun *run;
+        size_t begin, end;
+    };
+
+    // 一个线程在一轮中处理一块所用的全部缓冲区
+    struct Slot
+    {
+        LexRun main;          // 从块首开始的主序列
+        LexRun alts[2];       // 假设块首位于块注释、字符串内时的备选序列，只扫到与主序列汇合为止
+        int alt_count;
+        LexRun fix;           // 拼接时所有推测都不一致而重新扫描的序列
+        vector<Segment> parts; // 拼接结果
+        long long printed, first;
+        TokenWriter out;
+        Slot() : alt_count(0), printed(0), first(0), out(TOKEN_MEMORY) {}
+    };
+
+    const char *data;
+    size_t n;
+    int threads;
+    size_t chunk;
+    vector<size_t> bounds; // 块边界，bounds[k] 至 bounds[k + 1] 为第 k 块
+    vector<Slot> slots;
+
+    template <typename F>
+    void parallel_for(int count, F f)
+    {
+        vector<thread> pool;
+        for (int k = 1; k < count; k++)
+            pool.push_back(thread(f, k));
+        f(0);
+        for (thread &t : pool)
+            t.join();
+    }
+
+    // 块边界挪到下一个换行之后，使块首多半恰好是记号的开头
+    void split()
+    {
+        bounds.assign(1, 0);
+        size_t step = min(chunk, n / threads + 1);
+        while (n - bounds.back() > step)
+        {
+            size_t at = bounds.back() + step;
+            const void *nl = memchr(data + at, '\n', n - at);
+            at = nl ? (const char *)nl - data + 1 : n;
+            if (at >= n)
+                break;
+            bounds.push_back(at);
+        }
+        bounds.push_back(n);
+    }
+
+    // 从 from 开始逐记号扫描，直到某个记号的起点不小于 limit；
+    // 给出 target 时，走到 target 中某一项的起点即停下（此后两者完全相同）
+    void lex_run(size_t from, size_t limit, LexRun &run, const LexRun *target)
+    {
+        const unsigned char *src = (const unsigned char *)data;
+        MunchMemo memo;
+        size_t pos = from, t = 0;
+        run.toks.clear();
+        run.merge = (size_t)-1;
+        while (pos < limit && pos < n)
+        {
+            if (target)
+            {
+                while (t < target->toks.size() && target->toks[t].offset < pos)
+                    t++;
+                if (t < target->toks.size() && target->toks[t].offset == pos)
+                {
+                    run.merge = t;
+                    break;
+                }
+            }
+            int cat = 0, code = 0;
+            size_t len = memo.longest(src, pos, n, cat, code);
+            ChunkToken tok = {pos, (uint16_t)(len ? cat : 0), (uint16_t)code};
+            run.toks.push_back(tok);
+            pos += len ? len : 1;
+        }
+        run.end = pos;
+    }
+
+    // 第 k 块的推测扫描：主序列假设块首是记号的开头；块首若落在块注释或字符串中，
+    // 真实的记号从第一个 */ 或第一个未转义的 " 之后开始，各再扫一段直到与主序列汇合
+    void speculate(int k, Slot &slot)
+    {
+        size_t lo = bounds[k], hi = bounds[k + 1];
+        lex_run(lo, hi, slot.main, NULL);
+        slot.alt_count = 0;
+        if (k == 0)
+            return;
+
+        const char *end = data + hi;
+        const char *close = search(data + lo, end, "*/", "*/" + 2);
+        if (close != end)
+            lex_run(close - data + 2, hi, slot.alts[slot.alt_count++], &slot.main);
+        for (const char *q = data + lo; q < end; q++)
+            if (*q == '"' && q[-1] != '\\')
+            {
+                lex_run(q - data + 1, hi, slot.alts[slot.alt_count++], &slot.main);
+                break;
+            }
+    }
+
+    // run 中起点恰为 at 的项的下标，没有则返回 -1
+    static size_t find(const LexRun &run, uint64_t at)
+    {
+        ChunkToken key = {at, 0, 0};
+        vector<ChunkToken>::const_iterator it = lower_bound(run.toks.begin(), run.toks.end(), key,
+                                                            [](const ChunkToken &a, const ChunkToken &b) { return a.offset < b.offset; });
+        return it != run.toks.end() && it->offset == at ? it - run.toks.begin() : (size_t)-1;
+    }
+
+    // 拼接第 k 块：at 为真实记号序列进入本块的位置（前一块最后一个记号的结束处），
+    // 依次看主序列、备选序列中是否有记号恰从 at 开始，都没有则从 at 顺序扫描到与主序列汇合；
+    // 返回真实记号序列离开本块的位置
+    uint64_t stitch(int k, Slot &slot, uint64_t at)
+    {
+        slot.parts.clear();
+        if (at >= bounds[k + 1])
+            return at; // 前面的长记号覆盖了整块
+        size_t idx = find(slot.main, at);
+        if (idx == (size_t)-1)
+        {
+            const LexRun *run = NULL;
+            for (int a = 0; a < slot.alt_count && !run; a++)
+                if ((idx = find(slot.alts[a], at)) != (size_t)-1)
+                    run = &slot.alts[a];
+            if (!run)
+            {
+                lex_run(at, bounds[k + 1], slot.fix, &slot.main);
+                run = &slot.fix;
+                idx = 0;
+            }
+            Segment seg = {run, idx, run->toks.size()};
+            slot.parts.push_back(seg);
+            if (run->merge == (size_t)-1)
+                return run->end;
+            idx = run->merge;
+        }
+        Segment seg = {&slot.main, idx, slot.main.toks.size()};
+        slot.parts.push_back(seg);
+        return slot.main.end;
+    }
+
+    template <typename F>
+    void for_each_token(const Slot &slot, F f)
+    {
+        for (const Segment &seg : slot.parts)
+            for (size_t i = seg.begin; i < seg.end; i++)
+            {
+                const ChunkToken &ct = seg.run->toks[i];
+                if (ct.kind == 0 || ct.kind == CAT_WHITESPACE)
+                    continue;
+                uint64_t end = i + 1 < seg.run->toks.size() ? seg.run->toks[i + 1].offset : seg.run->end;
+                Token tok;
+                tok.kind = ct.kind;
+                tok.code = ct.code;
+                tok.text = string_view(data + ct.offset, end - ct.offset);
+                tok.offset = ct.offset;
+                tok.sym = SYM_NONE;
+                tok.num.type = NUM_NONE; // 只用于输出，不解码
+                f(tok);
+            }
+    }
+
+    // 一块输出的记号数，字符串、字符常量拆成引号、内容、引号
+    long long printed_count(const Slot &slot)
+    {
+        long long c = 0;
+        for_each_token(slot, [&](const Token &tok) {
+            if (tok.kind == CAT_STR || tok.kind == CAT_CHAR)
+                c += tok.text.size() > 2 ? 3 : 2;
+            else
+                c++;
+        });
+        return c;
+    }
+};
+
+// threads 个线程并行分析 data[0, n)，data[n] 须为 '\0'；输入很小时退回顺序的 scan()
+void parallel_scan(const char *data, size_t n, int threads)
+{
+    if (threads <= 1 || n < (1u << 16))
+    {
+        scan(data, n);
+        return;
+    }
+    ParallelLexer(data, n, threads).run();
+}
+#endif
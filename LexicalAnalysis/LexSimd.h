@@ -0,0 +1,111 @@
+// 自环状态的 SIMD 快速路径：在空白、标识符、注释体、字符串体等状态中，
+// 一次跳过整段不会改变状态的字节，DFA 只在会改变状态的字节上继续查表
+// 运行时按 CPU 支持选择 AVX2 / SSE2 实现，其余平台使用逐字节的标量实现
+#ifndef LEX_SIMD_H
+#define LEX_SIMD_H
+#include <cstddef>
+#include <cstdint>
+#include "LexTable.h"
+#include "../CpuFeatures.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LEX_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+inline bool lex_in_ranges(unsigned char c, const LexRanges &r)
+{
+    bool in = false;
+    for (int k = 0; k < r.n; k++)
+        in |= (unsigned char)(c - r.lo[k]) <= (unsigned char)(r.hi[k] - r.lo[k]);
+    return in;
+}
+
+// 标量实现：返回从 p 起第一个不在任何区间内的字节位置
+// 区间都不包含 '\0'，因此必定停在末尾哨兵处或之前
+inline size_t lex_skip_scalar(const unsigned char *data, size_t p, const LexRanges &r)
+{
+    while (lex_in_ranges(data[p], r))
+        p++;
+    return p;
+}
+
+#ifdef LEX_SIMD_X86
+// 向量化时按对齐地址整块读取：对齐的块不会跨页，读到哨兵所在块即可停止，不会越过缓冲区所在页
+__attribute__((target("sse2"))) inline size_t lex_skip_sse2(const unsigned char *data, size_t p, const LexRanges &r)
+{
+    __m128i lo[LEX_MAX_RANGES], width[LEX_MAX_RANGES];
+    for (int k = 0; k < r.n; k++)
+    {
+        lo[k] = _mm_set1_epi8((char)r.lo[k]);
+        width[k] = _mm_set1_epi8((char)(r.hi[k] - r.lo[k]));
+    }
+    const unsigned char *q = data + p;
+    size_t skew = (uintptr_t)q & 15;
+    const unsigned char *a = q - skew;
+    unsigned mask = 0xFFFFu << skew; // 忽略 q 之前的字节
+    while (true)
+    {
+        __m128i x = _mm_load_si128((const __m128i *)a);
+        __m128i in = _mm_setzero_si128();
+        for (int k = 0; k < r.n; k++)
+        {
+            // 无符号比较 x - lo <= hi - lo，即 min(x - lo, hi - lo) == x - lo
+            __m128i d = _mm_sub_epi8(x, lo[k]);
+            in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(d, width[k]), d));
+        }
+        unsigned out = ~(unsigned)_mm_movemask_epi8(in) & mask;
+        if (out)
+            return (a - data) + __builtin_ctz(out);
+        a += 16;
+        mask = 0xFFFFu;
+    }
+}
+
+__attribute__((target("avx2"))) inline size_t lex_skip_avx2(const unsigned char *data, size_t p, const LexRanges &r)
+{
+    __m256i lo[LEX_MAX_RANGES], width[LEX_MAX_RANGES];
+    for (int k = 0; k < r.n; k++)
+    {
+        lo[k] = _mm256_set1_epi8((char)r.lo[k]);
+        width[k] = _mm256_set1_epi8((char)(r.hi[k] - r.lo[k]));
+    }
+    const unsigned char *q = data + p;
+    size_t skew = (uintptr_t)q & 31;
+    const unsigned char *a = q - skew;
+    uint32_t mask = 0xFFFFFFFFu << skew;
+    while (true)
+    {
+        __m256i x = _mm256_load_si256((const __m256i *)a);
+        __m256i in = _mm256_setzero_si256();
+        for (int k = 0; k < r.n; k++)
+        {
+            __m256i d = _mm256_sub_epi8(x, lo[k]);
+            in = _mm256_or_si256(in, _mm256_cmpeq_epi8(_mm256_min_epu8(d, width[k]), d));
+        }
+        uint32_t out = ~(uint32_t)_mm256_movemask_epi8(in) & mask;
+        if (out)
+            return (a - data) + __builtin_ctz(out);
+        a += 32;
+        mask = 0xFFFFFFFFu;
+    }
+}
+#endif
+
+// 0: 标量，1: SSE2，2: AVX2；程序启动时按 CPU 检测一次
+inline int lex_simd_level = cpu_simd_level();
+
+inline size_t lex_skip(const unsigned char *data, size_t p, const LexRanges &r)
+{
+    // 关键字、短标识符、单个空格等短串很常见，先逐字节看几个，长串才交给向量实现
+    for (int k = 0; k < 8; k++, p++)
+        if (!lex_in_ranges(data[p], r))
+            return p;
+#ifdef LEX_SIMD_X86
+    if (lex_simd_level == 2)
+        return lex_skip_avx2(data, p, r);
+    if (lex_simd_level == 1)
+        return lex_skip_sse2(data, p, r);
+#endif
+    return lex_skip_scalar(data, p, r);
+}
+#endif
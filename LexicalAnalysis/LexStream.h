@@ -0,0 +1,276 @@
+// 流式词法分析：在固定大小的窗口上运行 DFA，窗口扫完后从文件中续读，
+// DFA 状态跨越窗口边界保留，位置一律用 64 位偏移表示，内存占用与输入大小无关（备忘录只随多读的区域增长）
+#ifndef LEX_STREAM_H
+#define LEX_STREAM_H
+#include "LexAnalysis.h"
+#include <fstream>
+#include <vector>
+
+class StreamLexer
+{
+public:
+    // in 须为可定位的文件流（需要回退与按偏移重读记号文本），window 为窗口字节数
+    StreamLexer(istream &in, size_t window = 1 << 20) : in(in), cap(window < 16 ? 16 : window),
+                                                          win(cap + 1), win_off(0), win_len(0)
+    {
+        in.seekg(0, ios::end);
+        file_size = (uint64_t)(streamoff)in.tellg();
+        win[0] = 0;
+    }
+
+    void run()
+    {
+        uint64_t i = 0;
+        while (i < file_size)
+        {
+            if (i < win_off || i >= win_off + win_len)
+                fill(i);
+
+            int cat = 0, code = 0;
+            uint64_t end;
+            if (i < memo_hi)
+                end = memo_match(i, cat, code);
+            else
+            {
+                uint64_t stop;
+                end = longest_match(i, cat, code, stop);
+                if (stop - end > LEX_MEMO_MIN)
+                {
+                    // DFA 读过头太多（未闭合的注释、字符串等），改用备忘录重新匹配，此后落在该区域内的匹配不再重复扫描
+                    fail.clear();
+                    memo_lo = memo_hi = i;
+                    end = memo_match(i, cat, code);
+                }
+            }
+            if (end > i)
+            {
+                // Token found
+                emit(i, end - i, cat, code);
+                i = end;
+            }
+            else
+            {
+                // No token matched, skip one char (or error)
+                i++;
+            }
+        }
+        tokenOut.flush();
+    }
+
+private:
+    istream &in;
+    uint64_t file_size;
+    size_t cap;           // 窗口容量
+    vector<char> win;     // 窗口缓冲区，win[win_len] 为 '\0' 哨兵
+    uint64_t win_off;     // 窗口首字节在文件中的偏移
+    size_t win_len;       // 窗口中的有效字节数
+    string text;          // 跨窗口记号的文本，长度不超过 cap
+
+    // 与 MunchMemo 相同的失败备忘录，位置为文件偏移；只覆盖多读的区域 [memo_lo, memo_hi)，
+    // 扫描起点之前的部分随时丢弃，内存只与尚未扫过的多读长度有关
+    vector<lex_fail_t> fail;  // fail[p - memo_lo]：在位置 p 处注定失败的状态集合
+    vector<lex_state_t> path; // 最后一次接收之后经过的状态，path[k] 对应位置 path_lo + k
+    uint64_t memo_lo = 0, memo_hi = 0;
+
+    // 从偏移 off 处重新读满窗口
+    void fill(uint64_t off)
+    {
+        in.clear();
+        in.seekg((streamoff)off);
+        in.read(&win[0], cap);
+        win_off = off;
+        win_len = in.gcount();
+        win[win_len] = 0;
+    }
+
+    // 从偏移 i 开始做最长匹配，DFA 读到窗口末尾时续读下一窗口；
+    // 返回记号结束偏移（等于 i 表示无匹配），stop 为 DFA 停下的偏移，窗口此后可能已前移越过 i
+    uint64_t longest_match(uint64_t i, int &cat, int &code, uint64_t &stop)
+    {
+        int curr = 0;
+        uint64_t last_end = i;
+        size_t k = i - win_off;
+
+        while (true)
+        {
+            const unsigned char c = win[k];
+            lex_state_t next = LEX_TRANS[curr][LEX_BYTE_CLASS[c]];
+            if (next == LEX_NONE)
+            {
+                if (c != 0)
+                    break;
+                if (k >= win_len)
+                {
+                    // 窗口的哨兵：文件结束则停止，否则续读，保留当前 DFA 状态
+                    if (win_off + win_len >= file_size)
+                        break;
+                    fill(win_off + win_len);
+                    k = 0;
+                    continue;
+                }
+                next = LEX_NUL_TRANS[curr];
+                if (next == LEX_NONE)
+                    break;
+            }
+
+            curr = next;
+            if (LEX_ACCEPT[curr] > 0)
+            {
+                cat = LEX_ACCEPT[curr];
+                code = LEX_CODE[curr];
+                last_end = win_off + k + 1;
+            }
+            k++;
+        }
+        stop = win_off + k;
+        return last_end;
+    }
+
+    // 偏移 p 处的字节，不在窗口中时续读；文件结束返回 -1
+    int byte_at(uint64_t p)
+    {
+        if (p < win_off || p >= win_off + win_len)
+        {
+            if (p >= file_size)
+                return -1;
+            fill(p);
+        }
+        return (unsigned char)win[p - win_off];
+    }
+
+    bool failed(int s, uint64_t p) const
+    {
+        return p >= memo_lo && p < memo_hi && (fail[p - memo_lo] & LEX_FAIL_BIT[s]);
+    }
+
+    // 与 longest_match() 结果相同，同时查询并更新备忘录（同 MunchMemo::match()）；
+    // 沿途的状态记在 path 中，不必像 MunchMemo 那样回到可能已移出窗口的字节上重走
+    uint64_t memo_match(uint64_t i, int &cat, int &code)
+    {
+        // 起点之前的记录不会再用到，占到一半以上时丢弃
+        if (i - memo_lo > fail.size() / 2)
+        {
+            fail.erase(fail.begin(), fail.begin() + (i - memo_lo));
+            memo_lo = i;
+        }
+
+        int curr = 0;
+        uint64_t last_end = i, path_lo = i, p = i;
+        path.clear();
+        while (!failed(curr, p))
+        {
+            path.push_back(curr);
+            int c = byte_at(p);
+            if (c < 0)
+                break;
+            lex_state_t next = LEX_TRANS[curr][LEX_BYTE_CLASS[c]];
+            if (next == LEX_NONE && c == 0)
+                next = LEX_NUL_TRANS[curr];
+            if (next == LEX_NONE)
+                break;
+            curr = next;
+            p++;
+            if (LEX_ACCEPT[curr] > 0)
+            {
+                cat = LEX_ACCEPT[curr];
+                code = LEX_CODE[curr];
+                last_end = p;
+                path.clear();
+                path_lo = p;
+            }
+        }
+
+        // 最后一次接收之后经过的 (状态, 位置) 都不可能再到达接收态
+        if (p + 1 > memo_hi)
+        {
+            memo_hi = p + 1;
+            fail.resize(memo_hi - memo_lo, 0);
+        }
+        for (size_t k = 0; k < path.size(); k++)
+            fail[path_lo + k - memo_lo] |= LEX_FAIL_BIT[path[k]];
+        fail[p - memo_lo] |= LEX_FAIL_BIT[curr];
+        if (max(last_end, i + 1) >= memo_hi)
+        {
+            // 扫描已越过记录的区域，释放备忘录
+            vector<lex_fail_t>().swap(fail);
+            vector<lex_state_t>().swap(path);
+            memo_lo = memo_hi = 0;
+        }
+        return last_end;
+    }
+
+    // 把 [off, off + len) 的文本读入 text，len 不超过窗口容量
+    void read_text(uint64_t off, size_t len)
+    {
+        text.resize(len);
+        in.clear();
+        in.seekg((streamoff)off);
+        in.read(&text[0], len);
+        win_len = 0; // 文件位置已改变，窗口需重新读入
+    }
+
+    // 分块输出 [off, off + len)
+    void print_range(uint64_t off, uint64_t len)
+    {
+        while (len > 0)
+        {
+            size_t n = len < cap ? len : cap;
+            read_text(off, n);
+            tokenOut.put(text);
+            off += n;
+            len -= n;
+        }
+    }
+
+    // 与 printToken() 相同的格式，文本部分分块写出
+    void print_long_token(uint64_t off, uint64_t len, int code)
+    {
+        tokenCount++;
+        if (tokenOut.tsv())
+        {
+            tokenOut.put_uint(code);
+            tokenOut.put('\t');
+            print_range(off, len);
+            tokenOut.put('\n');
+            return;
+        }
+        tokenOut.put_uint(tokenCount);
+        tokenOut.put(": <");
+        print_range(off, len);
+        tokenOut.put(',');
+        tokenOut.put_uint(code);
+        tokenOut.put(">\n");
+    }
+
+    void emit(uint64_t off, uint64_t len, int cat, int code)
+    {
+        if (off >= win_off && off + len <= win_off + win_len)
+        {
+            emitToken(&win[0], off - win_off, len, cat, code);
+            return;
+        }
+        if (len <= cap)
+        {
+            read_text(off, len);
+            emitToken(text.data(), 0, len, cat, code);
+            return;
+        }
+
+        // 超过窗口容量的记号（长注释、长字符串等）边读边输出，格式与 emitToken() 一致
+        if (cat == CAT_STR)
+        {
+            printToken("\"", code);
+            print_long_token(off + 1, len - 2, 81);
+            printToken("\"", code);
+        }
+        else if (cat == CAT_CHAR)
+        {
+            printToken("'", code);
+            print_long_token(off + 1, len - 2, 81);
+            printToken("'", code);
+        }
+        else if (cat != CAT_WHITESPACE)
+            print_long_token(off, len, code);
+    }
+};
+#endif
@@ -0,0 +1,491 @@
+#ifndef LEX_TABLE_H
+#define LEX_TABLE_H
+// 由 maker.cpp 自动生成，请勿手工修改
+#include <cstdint>
+const int CAT_KEYWORD = 1;
+const int CAT_ID = 2;
+const int CAT_NUM = 3;
+const int CAT_STR = 4;
+const int CAT_CHAR = 5;
+const int CAT_OP = 6;
+const int CAT_COMMENT_LINE = 7;
+const int CAT_COMMENT_BLOCK = 8;
+const int CAT_WHITESPACE = 9;
+struct LexKey { const char *text; int code; };
+constexpr LexKey LEX_KEYWORDS[] = {
+    {"auto", 1}, {"break", 2}, {"case", 3}, {"char", 4}, {"const", 5}, {"continue", 6}, {"default", 7}, {"do", 8},
+    {"double", 9}, {"else", 10}, {"enum", 11}, {"extern", 12}, {"float", 13}, {"for", 14}, {"goto", 15}, {"if", 16},
+    {"int", 17}, {"long", 18}, {"register", 19}, {"return", 20}, {"short", 21}, {"signed", 22}, {"sizeof", 23}, {"static", 24},
+    {"struct", 25}, {"switch", 26}, {"typedef", 27}, {"union", 28}, {"unsigned", 29}, {"void", 30}, {"volatile", 31}, {"while", 32},
+};
+const int LEX_KEYWORDS_COUNT = 32;
+constexpr LexKey LEX_OPERATORS[] = {
+    {"-", 33}, {"--", 34}, {"-=", 35}, {"->", 36}, {"!", 37}, {"!=", 38}, {"%", 39}, {"%=", 40},
+    {"&", 41}, {"&&", 42}, {"&=", 43}, {"(", 44}, {")", 45}, {"*", 46}, {"*=", 47}, {",", 48},
+    {".", 49}, {"/", 50}, {"/=", 51}, {":", 52}, {";", 53}, {"?", 54}, {"[", 55}, {"]", 56},
+    {"^", 57}, {"^=", 58}, {"{", 59}, {"|", 60}, {"||", 61}, {"|=", 62}, {"}", 63}, {"~", 64},
+    {"+", 65}, {"++", 66}, {"+=", 67}, {"<", 68}, {"<<", 69}, {"<<=", 70}, {"<=", 71}, {"=", 72},
+    {"==", 73}, {">", 74}, {">=", 75}, {">>", 76}, {">>=", 77}, {"\"", 78},
+};
+const int LEX_OPERATORS_COUNT = 46;
+const int LEX_RAW_STATE_COUNT = 239;
+const int LEX_STATE_COUNT = 217;
+const int LEX_CLASS_COUNT = 64;
+typedef uint8_t lex_state_t;
+const lex_state_t LEX_NONE = (lex_state_t)-1;
+constexpr unsigned char LEX_BYTE_CLASS[256] = {
+    0,1,1,1,1,1,1,1,1,2,3,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,4,5,1,1,6,7,8,9,10,11,12,13,14,15,16,17,18,18,18,18,18,18,18,18,18,19,20,21,22,23,24,
+    1,25,25,25,25,26,27,28,28,28,28,28,29,28,28,28,28,28,28,28,28,30,28,28,31,28,28,32,33,34,35,28,
+    1,36,37,38,39,40,41,42,43,44,28,45,46,47,48,49,50,28,51,52,53,54,55,56,57,58,59,60,61,62,63,1,
+    28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+    28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+    28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+    28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+};
+constexpr lex_state_t LEX_TRANS[LEX_STATE_COUNT][LEX_CLASS_COUNT] = {
+    {255,255,1,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,23,23,23,23,23,23,24,255,25,26,27,28,29,30,31,32,33,23,34,23,35,23,23,23,23,36,37,38,39,40,41,23,23,23,42,43,44,45},
+    {255,255,1,1,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,46,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,47,47,47,47,48,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,255,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,49,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,50,255,255,255,255,255,255,255,255,255,255,255,255,255,255,51,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,52,52,52,52,52,52,52,255,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,53,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,54,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,55,255,255,255,255,255,255,255,255,255,56,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,57,255,255,255,255,255,255,255,58,59,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,60,255,255,255,255,61,255,255,255,255,255,62,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,63,255,16,16,255,255,255,255,255,255,255,64,65,255,66,67,68,255,255,255,255,255,255,255,255,64,65,255,255,255,255,69,255,255,255,255,255,255,255,67,255,255,68,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,63,255,16,16,255,255,255,255,255,255,255,64,65,255,66,67,255,255,255,255,255,255,255,255,255,64,65,255,255,255,255,69,255,255,255,255,255,255,255,67,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,70,71,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,72,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,73,74,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,75,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,76,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,77,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,78,23,23,23,23,23,23,79,23,23,23,23,23,80,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,81,23,23,23,23,23,23,23,23,82,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,83,23,84,23,23,23,23,23,23,23,23,85,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,86,23,23,87,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,88,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,89,23,23,23,23,23,23,90,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,91,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,92,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,93,94,23,23,23,23,23,23,23,23,95,23,23,96,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,97,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,98,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,99,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,100,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,102,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,47,47,47,47,48,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,103,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,52,52,52,52,52,52,52,104,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52},
+    {255,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,60,60,60,60,60,60,60,60,60,60,105,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60},
+    {255,61,61,255,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,106,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,107,255,107,255,255,108,108,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,109,65,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,65,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,110,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,111,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,112,112,255,255,255,255,255,255,112,112,112,255,255,255,255,255,255,255,255,112,112,112,112,112,112,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,65,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,109,255,255,255,255,255,255,255,65,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,113,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,114,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,115,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,116,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,117,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,118,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,119,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,120,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,121,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,122,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,123,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,124,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,125,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,126,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,127,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,128,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,129,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,130,23,23,23,23,23,23,23,23,23,23,131,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,132,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,133,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,134,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,135,23,23,23,23,23,23,23,23,23,23,23,23,23,23,136,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,137,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,138,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,139,23,23,23,23,23,23,23,140,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,141,23,142,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,143,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,60,60,60,60,60,60,60,60,60,60,105,60,60,60,60,144,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,106,106,255,255,255,255,255,255,255,64,65,255,65,255,255,255,255,255,255,255,255,255,255,64,65,255,255,255,255,65,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,108,108,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,108,108,255,255,255,255,255,255,255,255,65,255,65,255,255,255,255,255,255,255,255,255,255,255,65,255,255,255,255,65,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,65,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,65,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,65,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,65,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,112,112,255,255,255,255,255,255,112,112,112,255,66,67,255,255,255,255,255,112,112,112,112,112,112,255,255,255,255,69,255,255,255,255,255,255,255,67,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,145,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,146,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,147,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,148,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,149,150,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,151,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,152,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,153,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,154,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,155,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,156,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,157,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,158,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,159,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,160,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,161,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,162,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,163,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,164,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,165,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,166,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,167,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,168,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,169,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,170,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,171,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,172,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,173,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,174,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,175,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,176,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,177,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,178,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,179,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,180,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,181,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,182,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,183,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,184,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,185,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,186,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,187,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,188,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,189,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,190,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,191,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,192,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,193,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,194,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,195,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,196,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,197,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,198,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,199,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,200,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,201,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,202,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,203,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,204,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,205,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,206,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,207,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,208,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,209,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,210,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,211,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,212,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,213,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,214,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,215,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,216,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+    {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,23,255,255,255,255,255,255,23,23,23,23,23,23,23,255,255,255,255,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,255,255,255,255},
+};
+constexpr lex_state_t LEX_NUL_TRANS[LEX_STATE_COUNT] = {255,255,255,47,255,255,52,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,47,255,255,255,255,52,52,255,255,255,255,255,255,60,61,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,47,255,60,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255};
+constexpr unsigned char LEX_ACCEPT[LEX_STATE_COUNT] = {0,9,6,6,6,6,0,6,6,6,6,6,6,6,6,3,3,6,6,6,6,6,6,2,6,6,6,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,0,4,6,6,6,0,0,6,6,6,6,6,6,0,7,6,0,0,3,3,3,0,3,6,6,6,6,6,6,2,2,2,2,2,2,1,2,2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,6,6,0,5,0,3,0,3,3,3,3,3,6,6,2,2,2,2,2,2,2,2,2,2,2,1,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,1,2,1,1,2,2,2,2,1,1,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,1,2,2,1,1,2,2,2,2,1,2,2,1,2,2,2,2,2,2,1,2,2,1,2,2,1,1,2,1,1,1,1,1,1,2,2,2,2,1,2,1,2,2,1,1,1,1};
+constexpr unsigned char LEX_CODE[LEX_STATE_COUNT] = {0,0,37,78,39,41,0,44,45,46,65,48,33,49,50,80,80,52,53,68,72,74,54,81,55,56,57,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,59,60,63,64,38,0,78,40,42,43,0,0,47,66,67,34,35,36,0,79,51,0,0,80,80,80,0,80,69,71,73,75,76,58,81,81,81,81,81,81,8,81,81,81,81,81,81,16,81,81,81,81,81,81,81,81,81,81,81,62,61,0,77,0,80,0,80,80,80,80,80,70,77,81,81,81,81,81,81,81,81,81,81,81,14,81,17,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,79,1,81,3,4,81,81,81,81,10,11,81,81,15,18,81,81,81,81,81,81,81,81,81,81,81,30,81,81,2,5,81,81,81,81,13,81,81,21,81,81,81,81,81,81,28,81,81,32,81,81,9,12,81,20,22,23,24,25,26,81,81,81,81,7,81,27,81,81,6,19,29,31};
+typedef uint16_t lex_fail_t;
+constexpr lex_fail_t LEX_FAIL_BIT[LEX_STATE_COUNT] = {1,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,8,16,0,0,0,0,0,0,32,0,0,64,128,0,0,0,256,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,512,0,1024,0,2048,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const int LEX_MAX_RANGES = 5;
+struct LexRanges { unsigned char n; unsigned char lo[LEX_MAX_RANGES]; unsigned char hi[LEX_MAX_RANGES]; };
+constexpr LexRanges LEX_SKIP[LEX_STATE_COUNT] = {
+    {0, {}, {}},
+    {3, {9,13,32}, {10,13,32}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {1, {48}, {57}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {5, {48,65,95,97,128}, {57,90,95,122,255}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {3, {1,35,93}, {33,91,255}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {2, {1,40}, {38,255}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {2, {1,43}, {41,255}},
+    {2, {1,11}, {9,255}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {1, {48}, {57}},
+    {0, {}, {}},
+    {1, {48}, {57}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {3, {48,65,97}, {57,70,102}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+    {0, {}, {}},
+};
+#endif
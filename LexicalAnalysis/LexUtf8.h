@@ -0,0 +1,253 @@
+// UTF-8 编码检查：在 DFA 之前对整个缓冲区跑一遍，找出第一个非法的多字节序列
+// DFA 把 0x80 以上的字节一律当作标识符、字符串、注释中的字符，不区分编码是否合法，合法性由这里负责
+// 向量实现按 Keiser、Lemire 的查表法：每个字节与前 1–3 个字节的高、低半字节各查一次 16 项的表，三者按位与即得错误，
+// 全是 ASCII 的 64 字节块只看一次最高位即跳过；运行时按 CPU 支持选择 AVX2 / SSSE3 实现，其余平台逐字节检查
+#ifndef LEX_UTF8_H
+#define LEX_UTF8_H
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include "../CpuFeatures.h"
+#include "../LineMap.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LEX_UTF8_X86 1
+#include <immintrin.h>
+#endif
+
+// 标量实现：从 data[i] 起检查，i 须是一个字符的开头；返回第一个非法序列首字节的偏移，都合法时返回 n
+// 按 RFC 3629：不允许超长编码、代理区 U+D800–U+DFFF 与 U+10FFFF 以上的码点，截断在末尾的序列也算非法
+inline size_t utf8_validate_scalar(const unsigned char *data, size_t i, size_t n)
+{
+    while (i < n)
+    {
+        // ASCII 一次看 8 个字节
+        if (i + 8 <= n)
+        {
+            uint64_t v;
+            memcpy(&v, data + i, 8);
+            if ((v & 0x8080808080808080ull) == 0)
+            {
+                i += 8;
+                continue;
+            }
+        }
+        unsigned char c = data[i];
+        if (c < 0x80)
+        {
+            i++;
+            continue;
+        }
+        // 第二个字节的范围随首字节而变，其余的后续字节都是 80–BF
+        size_t len;
+        unsigned char lo = 0x80, hi = 0xBF;
+        if (c >= 0xC2 && c <= 0xDF)
+            len = 2;
+        else if (c >= 0xE0 && c <= 0xEF)
+        {
+            len = 3;
+            if (c == 0xE0)
+                lo = 0xA0; // 超长编码
+            else if (c == 0xED)
+                hi = 0x9F; // 代理区
+        }
+        else if (c >= 0xF0 && c <= 0xF4)
+        {
+            len = 4;
+            if (c == 0xF0)
+                lo = 0x90; // 超长编码
+            else if (c == 0xF4)
+                hi = 0x8F; // U+10FFFF 以上
+        }
+        else
+            return i; // 孤立的后续字节、C0、C1、F5 以上
+        if (n - i < len || data[i + 1] < lo || data[i + 1] > hi)
+            return i;
+        for (size_t k = 2; k < len; k++)
+            if ((data[i + k] & 0xC0) != 0x80)
+                return i;
+        i += len;
+    }
+    return n;
+}
+
+// 向量实现查过 [0, i) 且未发现错误时标量实现的续查起点：末尾的首字节若还缺后续字节（前 3、2、1 个字节分别
+// 不小于 F0、E0、C0），其序列要与 i 之后的字节合起来判断，从它开始；否则 i 就是一个字符的开头
+inline size_t utf8_resume(const unsigned char *data, size_t i)
+{
+    static const unsigned char lead[4] = {0, 0xC0, 0xE0, 0xF0};
+    for (size_t k = 3; k > 0; k--)
+        if (i >= k && data[i - k] >= lead[k])
+            return i - k;
+    return i;
+}
+
+#ifdef LEX_UTF8_X86
+// 查表法中的错误位：前一个字节（首字节或后续字节）的高、低半字节与本字节的高半字节各对应一张表，
+// 某一位在三张表中都置位即为该类错误；3、4 字节序列的第 3、4 个字节另由 must_be_continuation 核对
+enum
+{
+    UTF8_TOO_SHORT = 1 << 0,  // 首字节后面没有足够的后续字节
+    UTF8_TOO_LONG = 1 << 1,   // ASCII 后面跟着后续字节
+    UTF8_OVERLONG_3 = 1 << 2, // E0 80–9F
+    UTF8_TOO_LARGE = 1 << 3,  // F4 90 以上、F5 以上
+    UTF8_SURROGATE = 1 << 4,  // ED A0–BF
+    UTF8_OVERLONG_2 = 1 << 5, // C0、C1
+    UTF8_TOO_LARGE_1000 = 1 << 6,
+    UTF8_OVERLONG_4 = 1 << 6, // F0 80–8F
+    UTF8_TWO_CONTS = 1 << 7,  // 连续两个后续字节，若不属于 3、4 字节序列即为错误
+    UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS,
+};
+
+#define UTF8_BYTE_1_HIGH                                                                                            \
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,         \
+        UTF8_TOO_LONG, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,                               \
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2, UTF8_TOO_SHORT, UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,         \
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+#define UTF8_BYTE_1_LOW                                                                                             \
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4, UTF8_CARRY | UTF8_OVERLONG_2, UTF8_CARRY,       \
+        UTF8_CARRY, UTF8_CARRY | UTF8_TOO_LARGE, UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  \
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,        \
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,        \
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,        \
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                                           \
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,                                          \
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+#define UTF8_BYTE_2_HIGH                                                                                            \
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,  \
+        UTF8_TOO_SHORT,                                                                                              \
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,  \
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,                         \
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,                          \
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE, UTF8_TOO_SHORT,          \
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+
+// 一个 16 字节块的错误位，prev 为前一块（第一块之前视为 ASCII）
+__attribute__((target("ssse3"))) inline __m128i utf8_block_ssse3(__m128i in, __m128i prev)
+{
+    const __m128i low4 = _mm_set1_epi8(0x0F);
+    __m128i prev1 = _mm_alignr_epi8(in, prev, 15);
+    __m128i b1_high = _mm_shuffle_epi8(_mm_setr_epi8(UTF8_BYTE_1_HIGH), _mm_and_si128(_mm_srli_epi16(prev1, 4), low4));
+    __m128i b1_low = _mm_shuffle_epi8(_mm_setr_epi8(UTF8_BYTE_1_LOW), _mm_and_si128(prev1, low4));
+    __m128i b2_high = _mm_shuffle_epi8(_mm_setr_epi8(UTF8_BYTE_2_HIGH), _mm_and_si128(_mm_srli_epi16(in, 4), low4));
+    __m128i special = _mm_and_si128(_mm_and_si128(b1_high, b1_low), b2_high);
+    // 前 2 个字节 >= E0 或前 3 个字节 >= F0 时本字节必须是后续字节，正好抵消 TWO_CONTS
+    __m128i third = _mm_subs_epu8(_mm_alignr_epi8(in, prev, 14), _mm_set1_epi8((char)(0xE0 - 0x80)));
+    __m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(in, prev, 13), _mm_set1_epi8((char)(0xF0 - 0x80)));
+    __m128i must = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+    return _mm_xor_si128(must, special);
+}
+
+// 块末尾的首字节后面还差几个后续字节（非零表示差），与下一块合起来才能判断
+__attribute__((target("ssse3"))) inline __m128i utf8_incomplete_ssse3(__m128i in)
+{
+    const __m128i max = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1),
+                                      (char)(0xE0 - 1), (char)(0xC0 - 1));
+    return _mm_subs_epu8(in, max);
+}
+
+__attribute__((target("ssse3"))) inline size_t utf8_validate_ssse3(const unsigned char *data, size_t n)
+{
+    __m128i prev = _mm_setzero_si128(), incomplete = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        __m128i x0 = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(data + i + 16));
+        __m128i x2 = _mm_loadu_si128((const __m128i *)(data + i + 32));
+        __m128i x3 = _mm_loadu_si128((const __m128i *)(data + i + 48));
+        __m128i error;
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3))) == 0)
+            error = incomplete; // 全是 ASCII：只需确认上一块没有截断的序列
+        else
+        {
+            error = utf8_block_ssse3(x0, prev);
+            error = _mm_or_si128(error, utf8_block_ssse3(x1, x0));
+            error = _mm_or_si128(error, utf8_block_ssse3(x2, x1));
+            error = _mm_or_si128(error, utf8_block_ssse3(x3, x2));
+        }
+        incomplete = utf8_incomplete_ssse3(x3);
+        prev = x3;
+        // 查表只说明这一块（或跨进来的序列）有错，具体位置交给标量实现
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xFFFF)
+            return utf8_validate_scalar(data, utf8_resume(data, i), n);
+    }
+    return utf8_validate_scalar(data, utf8_resume(data, i), n);
+}
+
+__attribute__((target("avx2"))) inline __m256i utf8_block_avx2(__m256i in, __m256i prev)
+{
+    const __m256i low4 = _mm256_set1_epi8(0x0F);
+    // 跨 128 位通道的错位：shifted 的低半为 prev 的高半、高半为 in 的低半
+    __m256i shifted = _mm256_permute2x128_si256(prev, in, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(in, shifted, 15);
+    __m256i b1_high = _mm256_shuffle_epi8(_mm256_setr_epi8(UTF8_BYTE_1_HIGH, UTF8_BYTE_1_HIGH),
+                                          _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low4));
+    __m256i b1_low = _mm256_shuffle_epi8(_mm256_setr_epi8(UTF8_BYTE_1_LOW, UTF8_BYTE_1_LOW), _mm256_and_si256(prev1, low4));
+    __m256i b2_high = _mm256_shuffle_epi8(_mm256_setr_epi8(UTF8_BYTE_2_HIGH, UTF8_BYTE_2_HIGH),
+                                          _mm256_and_si256(_mm256_srli_epi16(in, 4), low4));
+    __m256i special = _mm256_and_si256(_mm256_and_si256(b1_high, b1_low), b2_high);
+    __m256i third = _mm256_subs_epu8(_mm256_alignr_epi8(in, shifted, 14), _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(_mm256_alignr_epi8(in, shifted, 13), _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(must, special);
+}
+
+__attribute__((target("avx2"))) inline __m256i utf8_incomplete_avx2(__m256i in)
+{
+    const __m256i max = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                         -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1),
+                                         (char)(0xC0 - 1));
+    return _mm256_subs_epu8(in, max);
+}
+
+__attribute__((target("avx2"))) inline size_t utf8_validate_avx2(const unsigned char *data, size_t n)
+{
+    __m256i prev = _mm256_setzero_si256(), incomplete = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i x1 = _mm256_loadu_si256((const __m256i *)(data + i + 32));
+        __m256i error;
+        if (_mm256_movemask_epi8(_mm256_or_si256(x0, x1)) == 0)
+            error = incomplete;
+        else
+            error = _mm256_or_si256(utf8_block_avx2(x0, prev), utf8_block_avx2(x1, x0));
+        incomplete = utf8_incomplete_avx2(x1);
+        prev = x1;
+        if (!_mm256_testz_si256(error, error))
+            return utf8_validate_scalar(data, utf8_resume(data, i), n);
+    }
+    return utf8_validate_scalar(data, utf8_resume(data, i), n);
+}
+#endif
+
+// 0: 标量，1: SSSE3（查表要用 pshufb，SSE2 没有），2: AVX2；程序启动时按 CPU 检测一次
+inline int utf8_simd_level = cpu_simd_level(true);
+
+// 检查 data[0, n) 是否为合法的 UTF-8，返回第一个非法序列首字节的偏移，全部合法时返回 n
+inline size_t utf8_validate(const char *data, size_t n)
+{
+    const unsigned char *s = (const unsigned char *)data;
+#ifdef LEX_UTF8_X86
+    if (utf8_simd_level == 2)
+        return utf8_validate_avx2(s, n);
+    if (utf8_simd_level == 1)
+        return utf8_validate_ssse3(s, n);
+#endif
+    return utf8_validate_scalar(s, 0, n);
+}
+
+// 扫描前检查源码的编码，有非法序列时返回 false，并把 “名称:行:列: warning: ...” 写入 msg；
+// 词法分析照常进行，非法的字节与合法的多字节字符一样并入标识符、字符串或注释
+bool check_utf8(const char *data, size_t n, const string &name, string &msg)
+{
+    size_t bad = utf8_validate(data, n);
+    if (bad == n)
+        return true;
+    LinePos pos = LineMap(data, n).at(bad);
+    msg = name + ":" + to_string(pos.line) + ":" + to_string(pos.column) + ": warning: invalid UTF-8 sequence";
+    return false;
+}
+#endif
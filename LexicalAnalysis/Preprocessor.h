@@ -0,0 +1,2087 @@
+// C 预处理器：对象式与函数式宏（#、##、__VA_ARGS__）、条件编译与带搜索路径的 #include，输出展开后的记号序列
+// 每个头文件在进程中只读入、扫描一次：记号序列（含 '#' 记号与行首、前导空白标记）缓存在 Preprocessor 中，
+// 之后的翻译单元再 #include 时直接复用；扫描时顺带识别包含守卫，整个文件被 #ifndef X ... #endif 包住时记下 X，
+// 以后再包含且 X 已定义就整个跳过，连缓存的记号也不再走一遍（#pragma once 同理）
+// 宏展开按隐藏集（hide set）算法：每个记号记下展开出它的宏名集合，集合中的宏名不再展开
+// 前置头文件（add_prelude）预处理后的宏表与输出记号可以存成快照，以后的进程映射快照直接接着处理源文件
+// 与词法分析的输出相比，注释按空白处理、不再输出；续行在扫描之前整体去掉，字符串、字符常量按预处理记号的规则界定
+#ifndef PREPROCESSOR_H
+#define PREPROCESSOR_H
+#include "LexAnalysis.h"
+#include "LexInput.h"
+#include "LexUtf8.h"
+#include "../LineMap.h"
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#if !defined(_WIN32)
+#include <climits>
+#include <cstdlib>
+#include <sys/stat.h>
+#endif
+
+const uint8_t PP_BOL = 1;   // 行首的记号
+const uint8_t PP_SPACE = 2; // 前面有空白或注释
+const int PP_PARAM = -1;    // 宏体中的形参记号，code 为形参序号
+const int PP_MAX_DEPTH = 200; // #include 的最大嵌套深度
+
+// 预处理记号：词法分析的记号加上隐藏集与位置标记
+// 词法分析跳过的字节中，'#'、'##' 与其他非空白字符（如 '@'、'\'）也是预处理记号，kind 为 CAT_OP、code 为 0
+struct PPToken
+{
+    Token tok;
+    uint32_t hide; // 隐藏集编号，0 为空集
+    uint8_t flags; // PP_BOL、PP_SPACE
+};
+
+// 一个源文件及其记号序列，记号文本指向 buf、text 或 joined
+struct PPFile
+{
+    string path;          // 打开时用的路径，用于 __FILE__、引号形式的 #include 与错误信息
+    SourceBuffer buf;     // 磁盘上的文件直接映射
+    string text;          // 内存中的文件（Preprocessor::add_file、命令行宏）
+    bool in_memory;
+    string joined;             // 文件中有续行时，去掉全部 “\ 换行” 后的文本
+    vector<uint64_t> splices;  // joined 中每处去掉续行的位置，换算行号时补回
+    vector<PPToken> toks; // 不含空白与注释，offset 为在 lexed() 中的位置
+    uint32_t guard;       // 整个文件被 #ifndef guard ... #endif 包住时为守卫宏的编号，否则 SYM_NONE
+    unique_ptr<LineMap> lines; // 只在报告错误、展开 __LINE__ 时建立
+    bool lazy;            // 校验快照时已映射、guard 取自快照，尚未扫描；真正进入时才扫描
+
+    PPFile() : in_memory(false), guard(SYM_NONE), lazy(false) {}
+
+    // 文件原文，快照按它校验内容
+    const char *data() const { return in_memory ? text.c_str() : buf.data(); }
+    size_t size() const { return in_memory ? text.size() : buf.size(); }
+
+    // 实际扫描的文本：没有续行时就是原文
+    const char *lexed() const { return splices.empty() ? data() : joined.c_str(); }
+    size_t lexed_size() const { return splices.empty() ? size() : joined.size(); }
+
+    // 记号偏移所在的行号，去掉的续行仍按原文计入
+    size_t line(uint64_t offset)
+    {
+        if (!lines)
+            lines.reset(new LineMap(lexed(), lexed_size()));
+        return lines->line(offset) + (upper_bound(splices.begin(), splices.end(), offset) - splices.begin());
+    }
+};
+
+// 隐藏集：宏名编号的有序集合，相同的集合只存一份，以编号代表；并集、交集的结果按操作数缓存
+class HideSets
+{
+public:
+    HideSets() : sets(1) { ids[sets[0]] = 0; }
+
+    bool contains(uint32_t h, uint32_t sym) const
+    {
+        return h != 0 && binary_search(sets[h].begin(), sets[h].end(), sym);
+    }
+
+    uint32_t add(uint32_t h, uint32_t sym)
+    {
+        uint64_t key = (uint64_t)h << 32 | sym;
+        unordered_map<uint64_t, uint32_t>::iterator it = adds.find(key);
+        if (it != adds.end())
+            return it->second;
+        vector<uint32_t> s = sets[h];
+        s.insert(lower_bound(s.begin(), s.end(), sym), sym);
+        return adds[key] = intern(s);
+    }
+
+    uint32_t unite(uint32_t a, uint32_t b)
+    {
+        if (a == b || b == 0)
+            return a;
+        if (a == 0)
+            return b;
+        uint64_t key = (uint64_t)a << 32 | b;
+        unordered_map<uint64_t, uint32_t>::iterator it = unions.find(key);
+        if (it != unions.end())
+            return it->second;
+        vector<uint32_t> s;
+        set_union(sets[a].begin(), sets[a].end(), sets[b].begin(), sets[b].end(), back_inserter(s));
+        return unions[key] = intern(s);
+    }
+
+    uint32_t meet(uint32_t a, uint32_t b)
+    {
+        if (a == b)
+            return a;
+        if (a == 0 || b == 0)
+            return 0;
+        vector<uint32_t> s;
+        set_intersection(sets[a].begin(), sets[a].end(), sets[b].begin(), sets[b].end(), back_inserter(s));
+        return intern(s);
+    }
+
+private:
+    vector<vector<uint32_t>> sets;
+    map<vector<uint32_t>, uint32_t> ids;
+    unordered_map<uint64_t, uint32_t> adds, unions;
+
+    uint32_t intern(const vector<uint32_t> &s)
+    {
+        map<vector<uint32_t>, uint32_t>::iterator it = ids.find(s);
+        if (it != ids.end())
+            return it->second;
+        sets.push_back(s);
+        return ids[s] = sets.size() - 1;
+    }
+};
+
+struct PPMacro
+{
+    vector<PPToken> body; // 替换列表，形参记号的 kind 为 PP_PARAM
+    int params;           // 形参个数，可变参数宏含 __VA_ARGS__
+    bool function;
+    bool variadic;
+    int builtin; // PP_FILE、PP_LINE，普通宏为 0
+};
+
+const int PP_FILE = 1;
+const int PP_LINE = 2;
+
+// 预处理快照（类似预编译头）：预处理完一组前置头文件（--include）后的宏表与输出记号，写成可直接映射的文件
+// 文件布局（主机字节序，同 TokenFile.h 只在小端机器上生成与读取）：
+//   PchHeader                 64 字节
+//   PchDep[deps]              读到的每个文件：路径、长度与内容哈希，任何一个变了快照即作废
+//   PchName[names]            出现过的标识符、关键字，装入时每个只驻留一次，记号按下标引用
+//   PchMacro[macros]          快照结束时仍有定义的宏（不含 __FILE__、__LINE__）
+//   PchToken[body]            各宏的替换列表依次排列
+//   PchToken[tokens]          前置头文件展开后的输出记号
+//   字符串表[strings]         路径与记号文本，相同的只存一次，每条后跟一个 '\0'
+const char PCH_MAGIC[4] = {'C', 'P', 'C', 'H'};
+const uint32_t PCH_VERSION = 1;
+const uint32_t PCH_ONCE = 1;         // PchDep::flags：执行过 #pragma once
+const uint32_t PCH_NONE = UINT32_MAX; // 没有守卫宏、不是名字的记号
+
+struct PchHeader
+{
+    char magic[4];   // "CPCH"
+    uint32_t version; // PCH_VERSION
+    uint64_t config;  // -D、-I 与前置头文件列表的哈希，须与使用时相同
+    uint64_t deps, names, macros, body, tokens;
+    uint64_t strings; // 字符串表字节数
+};
+
+struct PchDep
+{
+    uint64_t size;
+    uint64_t hash; // pp_content_hash
+    uint32_t path, path_len; // 路径在字符串表中的偏移与长度
+    uint32_t guard;          // 守卫宏在 PchName 中的下标，或 PCH_NONE
+    uint32_t flags;          // PCH_ONCE
+};
+
+struct PchName
+{
+    uint32_t text, length;
+};
+
+struct PchMacro
+{
+    uint32_t name;         // PchName 中的下标
+    uint32_t first, count; // 替换列表为 body 中 [first, first + count)
+    int32_t params;
+    uint8_t function, variadic;
+    uint8_t pad[6];
+};
+
+struct PchToken
+{
+    uint64_t offset;
+    uint32_t text, length;
+    uint32_t name; // 标识符、关键字与形参在 PchName 中的下标，其他记号为 PCH_NONE
+    int16_t kind;  // 形参为 PP_PARAM
+    uint16_t code;
+    uint8_t flags;
+    uint8_t pad[7];
+};
+
+static_assert(sizeof(PchHeader) == 64 && sizeof(PchDep) == 32 && sizeof(PchName) == 8 && sizeof(PchMacro) == 24 &&
+                  sizeof(PchToken) == 32,
+              "pch file layout");
+
+// 快照依赖文件的内容哈希：每次取 8 字节乘法混合，只用来发现文件被改动，不防故意构造的碰撞
+inline uint64_t pp_content_hash(const char *p, size_t n)
+{
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ n;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    uint64_t w = 0;
+    memcpy(&w, p + i, n - i);
+    h = (h ^ w) * 0xC4CEB9FE1A85EC53ull;
+    return h ^ h >> 29;
+}
+
+// 用法：Preprocessor pp; pp.add_include_dir("include"); pp.run("a.c", sink);
+// 同一个 Preprocessor 依次处理多个翻译单元时，头文件的记号缓存与守卫信息一直保留，宏、条件栈每次重新开始
+class Preprocessor
+{
+public:
+    // 统计：#include 指令数、因守卫宏或 #pragma once 整个跳过的次数、读入并扫描的文件数
+    struct Stats
+    {
+        long long includes, skipped, files_read;
+    };
+
+    Preprocessor()
+        : cache(true), strs(NULL), strs_size(0), snap_ok(false), replay_at(0), recording(false), in_list(0), errors(0),
+          at_off(0), ex(NULL), ei(0), bad(false)
+    {
+        counts.includes = counts.skipped = counts.files_read = 0;
+    }
+
+    void add_include_dir(const string &dir) { dirs.push_back(dir); }
+
+    // 同命令行的 -D：NAME 定义为 1，NAME=值 定义为该值
+    void define(const string &def)
+    {
+        size_t eq = def.find('=');
+        if (eq == string::npos)
+            predefs += "#define " + def + " 1\n";
+        else
+            predefs += "#define " + def.substr(0, eq) + " " + def.substr(eq + 1) + "\n";
+    }
+
+    // 内存中的文件，与磁盘上的文件一样参与 #include 的查找，path 按原样匹配
+    void add_file(const string &path, const string &text)
+    {
+        unique_ptr<PPFile> f(new PPFile);
+        f->path = path;
+        f->text = text;
+        f->in_memory = true;
+        tokenize(*f);
+        files[path] = move(f);
+    }
+
+    // 关闭缓存时每次 #include 都重新查找、读入并扫描文件，也不做守卫优化（只用于比较）
+    void set_cache(bool on) { cache = on; }
+
+    // 预处理源文件 path，展开后的记号依次交给 sink.onToken()；有错误时返回 false，错误信息见 messages()
+    template <typename Sink>
+    bool run(const string &path, Sink &sink)
+    {
+        if (!begin(path))
+            return false;
+        Token tok;
+        while (next(tok))
+            sink.onToken(tok);
+        return errors == 0;
+    }
+
+    // 开始预处理 path（也可以是 add_file 给出的内存中的文件），之后由 next() 逐个取出记号
+    bool begin(const string &path) { return start(&path); }
+
+    // 同 gcc 的 -include：每个翻译单元在主文件之前依次预处理这些头文件，按引号形式的 #include 从当前目录查找
+    void add_prelude(const string &path) { preludes.push_back(path); }
+
+    // 只预处理前置头文件，把之后的宏表与输出记号写成快照 out；有错误或写入失败时返回 false，错误信息见 messages()
+    bool save_snapshot(const string &out)
+    {
+        drop_snapshot();
+        recording = true;
+        deps.clear();
+        bool ok = start(NULL);
+        vector<Token> toks;
+        Token tok;
+        while (ok && next(tok))
+            toks.push_back(tok);
+        recording = false;
+        return ok && errors == 0 && write_snapshot(out, toks);
+    }
+
+    // 映射并校验快照：-D、-I 与前置头文件须与当前设置相同，读到过的每个文件长度与内容哈希须未变
+    // 成功后各翻译单元不再预处理前置头文件，直接装入快照中的宏、先输出快照中的记号；
+    // 快照无法读取或已过期时返回 false，此后照常预处理前置头文件
+    bool load_snapshot(const string &path)
+    {
+        drop_snapshot();
+        if (map_snapshot(path))
+            return true;
+        drop_snapshot();
+        return false;
+    }
+
+    // 取下一个展开后的记号，全部读完时返回 false
+    bool next(Token &out)
+    {
+        if (replay_at < replay.size())
+        {
+            out = replay[replay_at++];
+            return true;
+        }
+        PPToken t;
+        while (read(t))
+        {
+            if (expand(t))
+                continue;
+            if (t.tok.kind == CAT_OP && t.tok.code == 0)
+                continue; // 正文中游离的 '#' 等字符，与词法分析一样不输出
+            out = t.tok;
+            return true;
+        }
+        return false;
+    }
+
+    // 错误与 #warning 的信息，格式为 “文件:行: error: 内容”；源文件中非法的 UTF-8 编码为 “文件:行:列: warning: ...”
+    const vector<string> &messages() const { return msgs; }
+    const Stats &stats() const { return counts; }
+
+    // 标识符、关键字记号的 sym 为其在此池中的编号
+    SymbolPool &symbols() { return names; }
+
+private:
+    struct Frame
+    {
+        PPFile *file;
+        int dir;                  // 在第几个搜索路径中找到，不是经搜索路径找到的为 -1
+        size_t pos;
+        size_t cond_base;         // 进入本文件时条件栈的深度
+        unique_ptr<PPFile> owned; // 不进缓存的文件：主文件、命令行宏、关闭缓存时的头文件
+        int64_t line_delta;       // #line 给出的行号与实际行号之差
+        string name;              // #line 给出的文件名，为空时用 file->path
+    };
+
+    // 条件编译的一层：taken 为已有分支成立，else_seen 为已遇到 #else，offset 为 #if 所在位置
+    struct Cond
+    {
+        bool taken, else_seen;
+        uint64_t offset;
+    };
+
+    SymbolPool names;  // 标识符与关键字
+    SymbolPool texts;  // 粘接、字符串化等新生成的记号文本，以 '\0' 结尾，可直接交给 Lexer
+    HideSets hides;
+    vector<string> dirs;
+    string predefs;
+    bool cache;
+    unordered_map<string, unique_ptr<PPFile>> files; // 规范化的路径 -> 文件
+    // 查找 #include 的结果：file 为 NULL 表示找不到，dir 同 Frame::dir
+    struct Found
+    {
+        PPFile *file;
+        int dir;
+    };
+    unordered_map<string, Found> found; // 查找键 -> 结果
+    Stats counts;
+    vector<string> preludes; // add_prelude 给出的前置头文件
+
+    // 快照：snap 为映射的文件，其中的字符串表由 strs 指向；宏体与 replay 的记号文本都指向映射
+    SourceBuffer snap;
+    const char *strs;
+    size_t strs_size;
+    bool snap_ok; // 已装入且校验通过
+    vector<uint32_t> snap_syms; // PchName 下标 -> names 中的编号
+    vector<pair<uint32_t, PPMacro>> snap_macros;
+    vector<string> snap_once;
+    vector<Token> replay;   // 前置头文件的输出记号
+    size_t replay_at;       // 本翻译单元下一个要输出的 replay 下标，等于 replay.size() 时不再输出
+    bool recording;         // 正在生成快照，记下读到的文件
+    vector<PPFile *> deps;  // 生成快照时读到的文件，按首次读到的顺序
+    unordered_set<PPFile *> dep_seen;
+
+    // 每个翻译单元的状态
+    vector<PPMacro> macros;
+    vector<int> macro_of; // 名字编号 -> macros 中的下标，未定义为 -1
+    vector<Cond> conds;
+    vector<Frame> frames;
+    vector<unique_ptr<PPFile>> retired; // 已读完、不在缓存中的文件
+    vector<PPToken> pending; // 待重新扫描的记号，逆序存放，back() 为下一个
+    int in_list;             // 大于 0 时只展开 pending 中的记号，不读文件
+    unordered_set<string> once; // 本翻译单元中执行过 #pragma once 的文件
+    vector<string> msgs;
+    int errors;
+    PPFile *at_file; // 最近读到的文件记号，用于 __LINE__ 与错误位置
+    uint64_t at_off;
+
+    // #if 表达式求值的状态：skip 大于 0 时处在不求值的操作数中（&& 与 || 的右侧、?: 未选中的一支），不报除零
+    const vector<PPToken> *ex;
+    size_t ei;
+    bool bad;
+    int skip;
+
+    // #if 中的值：按 intmax_t 或 uintmax_t（unsigned 为真）运算
+    struct Value
+    {
+        uint64_t v;
+        bool is_unsigned;
+    };
+
+    void reset()
+    {
+        macros.clear();
+        macro_of.assign(names.size(), -1);
+        conds.clear();
+        frames.clear();
+        retired.clear();
+        pending.clear();
+        in_list = 0;
+        once.clear();
+        msgs.clear();
+        errors = 0;
+        at_file = NULL;
+        at_off = 0;
+        replay_at = replay.size();
+        define_builtin("__FILE__", PP_FILE);
+        define_builtin("__LINE__", PP_LINE);
+    }
+
+    void define_builtin(const char *name, int kind)
+    {
+        PPMacro m;
+        m.params = 0;
+        m.function = m.variadic = false;
+        m.builtin = kind;
+        set_macro(names.intern(name), m);
+    }
+
+    void set_macro(uint32_t sym, const PPMacro &m)
+    {
+        if (sym >= macro_of.size())
+            macro_of.resize(names.size(), -1);
+        if (macro_of[sym] >= 0)
+            macros[macro_of[sym]] = m;
+        else
+        {
+            macro_of[sym] = macros.size();
+            macros.push_back(m);
+        }
+    }
+
+    bool defined(uint32_t sym) const { return sym < macro_of.size() && macro_of[sym] >= 0; }
+
+    void message(const char *kind, const string &msg)
+    {
+        string where = at_file ? at_name() + ":" + to_string(at_line()) + ": " : "";
+        msgs.push_back(where + kind + ": " + msg);
+    }
+
+    // at_file 所在的那一层；同一文件递归包含时取最内层
+    const Frame *at_frame() const
+    {
+        for (size_t k = frames.size(); k-- > 0;)
+            if (frames[k].file == at_file)
+                return &frames[k];
+        return NULL;
+    }
+
+    // 当前位置的行号与文件名，经 #line 改过时按改后的算（__LINE__、__FILE__ 与错误信息用）
+    size_t at_line()
+    {
+        const Frame *f = at_frame();
+        return at_file->line(at_off) + (f ? f->line_delta : 0);
+    }
+
+    string at_name() const
+    {
+        const Frame *f = at_frame();
+        return f && !f->name.empty() ? f->name : at_file->path;
+    }
+
+    void error(const string &msg)
+    {
+        message("error", msg);
+        errors++;
+    }
+
+    static bool is(const PPToken &t, const char *s) { return t.tok.text == s && t.tok.kind != CAT_STR && t.tok.kind != CAT_CHAR; }
+    static bool is_hash(const PPToken &t) { return t.tok.kind == CAT_OP && t.tok.code == 0 && t.tok.text == "#"; }
+    static bool is_paste(const PPToken &t) { return t.tok.kind == CAT_OP && t.tok.code == 0 && t.tok.text == "##"; }
+    static bool is_name(const PPToken &t) { return t.tok.kind == CAT_ID || t.tok.kind == CAT_KEYWORD; }
+
+    // ---- 快照 ----
+
+    // 映射快照 path 并逐项校验、装入，任何一项不符即返回 false，已装入的部分由调用者丢弃
+    bool map_snapshot(const string &path)
+    {
+        if (!snap.open_file(path.c_str()) || snap.size() < sizeof(PchHeader))
+            return false;
+        const PchHeader *h = (const PchHeader *)snap.data();
+        if (memcmp(h->magic, PCH_MAGIC, 4) != 0 || h->version != PCH_VERSION || h->config != config_hash())
+            return false;
+        size_t left = snap.size() - sizeof(PchHeader);
+        const uint64_t counts[] = {h->deps, h->names, h->macros, h->body, h->tokens};
+        const size_t sizes[] = {sizeof(PchDep), sizeof(PchName), sizeof(PchMacro), sizeof(PchToken), sizeof(PchToken)};
+        for (int k = 0; k < 5; k++)
+        {
+            if (counts[k] > left / sizes[k])
+                return false;
+            left -= counts[k] * sizes[k];
+        }
+        if (h->strings != left || h->names >= PCH_NONE || h->body >= PCH_NONE)
+            return false;
+        const PchDep *dep = (const PchDep *)(snap.data() + sizeof(PchHeader));
+        const PchName *nm = (const PchName *)(dep + h->deps);
+        const PchMacro *mac = (const PchMacro *)(nm + h->names);
+        const PchToken *bt = (const PchToken *)(mac + h->macros);
+        const PchToken *ot = bt + h->body;
+        strs = (const char *)(ot + h->tokens);
+        strs_size = h->strings;
+
+        snap_syms.resize(h->names);
+        for (size_t k = 0; k < h->names; k++)
+        {
+            string_view name;
+            if (!str(nm[k].text, nm[k].length, name))
+                return false;
+            snap_syms[k] = names.intern(name);
+        }
+
+        // 依赖的文件：已在缓存中的按缓存的内容比较，否则映射磁盘上的文件；通过校验后（开着缓存时）留作缓存，
+        // 只记下快照中的守卫宏而不扫描，主文件再 #include 它们时直接按守卫跳过
+        vector<pair<string, unique_ptr<PPFile>>> staged;
+        for (size_t d = 0; d < h->deps; d++)
+        {
+            string_view p;
+            if (!str(dep[d].path, dep[d].path_len, p) || (dep[d].guard != PCH_NONE && dep[d].guard >= h->names))
+                return false;
+            string name(p), key;
+            unordered_map<string, unique_ptr<PPFile>>::iterator it = files.find(name);
+            PPFile *f = NULL;
+            unique_ptr<PPFile> fresh;
+            if (it != files.end() && it->second->in_memory)
+                f = it->second.get();
+            else if (locate(name, key) && (it = files.find(key)) != files.end())
+                f = it->second.get();
+            else
+            {
+                fresh.reset(new PPFile);
+                fresh->path = name;
+                if (key.empty() || !fresh->buf.open_file(key.c_str()))
+                    return false;
+                f = fresh.get();
+            }
+            if (f->size() != dep[d].size || pp_content_hash(f->data(), f->size()) != dep[d].hash)
+                return false;
+            if (dep[d].flags & PCH_ONCE)
+                snap_once.push_back(name);
+            if (!fresh)
+                continue;
+            fresh->guard = dep[d].guard == PCH_NONE ? SYM_NONE : snap_syms[dep[d].guard];
+            fresh->lazy = true;
+            staged.push_back(make_pair(key, move(fresh)));
+        }
+
+        snap_macros.resize(h->macros);
+        for (size_t m = 0; m < h->macros; m++)
+        {
+            if (mac[m].name >= h->names || mac[m].first > h->body || mac[m].count > h->body - mac[m].first || mac[m].params < 0)
+                return false;
+            PPMacro &pm = snap_macros[m].second;
+            snap_macros[m].first = snap_syms[mac[m].name];
+            pm.params = mac[m].params;
+            pm.function = mac[m].function;
+            pm.variadic = mac[m].variadic;
+            pm.builtin = 0;
+            pm.body.resize(mac[m].count);
+            for (uint32_t k = 0; k < mac[m].count; k++)
+            {
+                PPToken &t = pm.body[k];
+                t.hide = 0;
+                t.flags = bt[mac[m].first + k].flags;
+                if (!unpack(bt[mac[m].first + k], h->names, t.tok) || (t.tok.kind == PP_PARAM && t.tok.code >= pm.params))
+                    return false;
+            }
+        }
+        replay.resize(h->tokens);
+        for (size_t k = 0; k < h->tokens; k++)
+            if (!unpack(ot[k], h->names, replay[k]))
+                return false;
+
+        if (cache)
+            for (pair<string, unique_ptr<PPFile>> &f : staged)
+                files[f.first] = move(f.second);
+        snap_ok = true;
+        return true;
+    }
+
+    void drop_snapshot()
+    {
+        snap_ok = false;
+        strs = NULL;
+        strs_size = 0;
+        snap_syms.clear();
+        snap_macros.clear();
+        snap_once.clear();
+        replay.clear();
+        replay_at = 0;
+    }
+
+    // 快照适用的设置：-D、-I 与前置头文件列表，任何一项不同都不能使用
+    uint64_t config_hash() const
+    {
+        string s = predefs;
+        for (const string &d : dirs)
+            s += '\0' + d;
+        s += '\1';
+        for (const string &p : preludes)
+            s += '\0' + p;
+        return pp_content_hash(s.data(), s.size());
+    }
+
+    // 字符串表中偏移 off、长度 len 的字符串，越界返回 false
+    bool str(uint32_t off, uint32_t len, string_view &out) const
+    {
+        if (off > strs_size || len > strs_size - off)
+            return false;
+        out = string_view(strs + off, len);
+        return true;
+    }
+
+    bool unpack(const PchToken &r, size_t name_count, Token &tok) const
+    {
+        if (!str(r.text, r.length, tok.text) || (r.name != PCH_NONE && r.name >= name_count))
+            return false;
+        tok.kind = r.kind;
+        tok.code = r.code;
+        tok.offset = r.offset;
+        tok.sym = r.name == PCH_NONE ? SYM_NONE : snap_syms[r.name];
+        decode_number(tok);
+        return true;
+    }
+
+    void note_dep(PPFile *f)
+    {
+        if (dep_seen.insert(f).second)
+            deps.push_back(f);
+    }
+
+    // 写出快照：deps 与当前的宏表、once 集合来自刚预处理完的前置头文件，toks 为其输出记号
+    bool write_snapshot(const string &path, const vector<Token> &toks)
+    {
+        string strings;
+        unordered_map<string_view, uint32_t> seen; // 键指向源缓冲区或本对象持有的字符串
+        bool fits = true;
+        auto put = [&](string_view s) -> uint32_t {
+            pair<unordered_map<string_view, uint32_t>::iterator, bool> ins = seen.insert(make_pair(s, (uint32_t)strings.size()));
+            if (ins.second)
+            {
+                fits = fits && strings.size() + s.size() + 1 < UINT32_MAX;
+                strings.append(s.data(), s.size());
+                strings.push_back('\0');
+            }
+            return ins.first->second;
+        };
+        vector<PchName> ns;
+        unordered_map<uint32_t, uint32_t> name_at; // names 中的编号 -> ns 中的下标
+        auto name = [&](uint32_t sym) -> uint32_t {
+            pair<unordered_map<uint32_t, uint32_t>::iterator, bool> ins = name_at.insert(make_pair(sym, (uint32_t)ns.size()));
+            if (ins.second)
+            {
+                PchName r = {put(names.name(sym)), (uint32_t)names.name(sym).size()};
+                ns.push_back(r);
+            }
+            return ins.first->second;
+        };
+        auto pack = [&](const Token &t, uint8_t flags) {
+            PchToken r;
+            memset(&r, 0, sizeof(r));
+            r.offset = t.offset;
+            r.text = put(t.text);
+            r.length = t.text.size();
+            r.name = PCH_NONE;
+            if (is_name_kind(t.kind) || t.kind == PP_PARAM)
+                r.name = name(t.sym != SYM_NONE ? t.sym : names.intern(t.text));
+            r.kind = t.kind;
+            r.code = t.code;
+            r.flags = flags;
+            return r;
+        };
+
+        vector<PchDep> ds;
+        for (PPFile *f : deps)
+        {
+            PchDep d;
+            d.size = f->size();
+            d.hash = pp_content_hash(f->data(), f->size());
+            d.path = put(f->path);
+            d.path_len = f->path.size();
+            d.guard = f->guard == SYM_NONE ? PCH_NONE : name(f->guard);
+            d.flags = once.count(f->path) ? PCH_ONCE : 0;
+            ds.push_back(d);
+        }
+        vector<PchMacro> ms;
+        vector<PchToken> body, out;
+        for (uint32_t sym = 0; sym < macro_of.size(); sym++)
+        {
+            if (macro_of[sym] < 0 || macros[macro_of[sym]].builtin)
+                continue;
+            const PPMacro &m = macros[macro_of[sym]];
+            PchMacro r;
+            memset(&r, 0, sizeof(r));
+            r.name = name(sym);
+            r.first = body.size();
+            r.count = m.body.size();
+            r.params = m.params;
+            r.function = m.function;
+            r.variadic = m.variadic;
+            for (const PPToken &t : m.body)
+                body.push_back(pack(t.tok, t.flags));
+            ms.push_back(r);
+        }
+        for (const Token &t : toks)
+            out.push_back(pack(t, 0));
+        if (!fits || body.size() >= PCH_NONE || ns.size() >= PCH_NONE)
+            return false;
+
+        PchHeader h;
+        memcpy(h.magic, PCH_MAGIC, 4);
+        h.version = PCH_VERSION;
+        h.config = config_hash();
+        h.deps = ds.size();
+        h.names = ns.size();
+        h.macros = ms.size();
+        h.body = body.size();
+        h.tokens = out.size();
+        h.strings = strings.size();
+        ofstream f(path, ios::binary);
+        f.write((const char *)&h, sizeof(h));
+        f.write((const char *)ds.data(), ds.size() * sizeof(PchDep));
+        f.write((const char *)ns.data(), ns.size() * sizeof(PchName));
+        f.write((const char *)ms.data(), ms.size() * sizeof(PchMacro));
+        f.write((const char *)body.data(), body.size() * sizeof(PchToken));
+        f.write((const char *)out.data(), out.size() * sizeof(PchToken));
+        f.write(strings.data(), strings.size());
+        return (bool)f.flush();
+    }
+
+    // 开始一个翻译单元：path 为 NULL 时只预处理前置头文件（生成快照）；已装入快照时改为装入其中的宏并重放其记号
+    bool start(const string *path)
+    {
+        reset();
+        bool resume = snap_ok;
+        // 前置头文件在主文件入栈之前查找，引号形式从当前目录开始
+        vector<pair<Found, unique_ptr<PPFile>>> pre;
+        for (size_t k = 0; !resume && k < preludes.size(); k++)
+        {
+            unique_ptr<PPFile> owned;
+            Found r = find_include(preludes[k], true, 0, owned);
+            if (!r.file)
+            {
+                error(preludes[k] + ": No such file or directory");
+                return false;
+            }
+            if (recording)
+                note_dep(r.file);
+            pre.push_back(make_pair(r, move(owned)));
+        }
+        if (path)
+        {
+            PPFile *f;
+            unordered_map<string, unique_ptr<PPFile>>::iterator it = files.find(*path);
+            if (it != files.end() && it->second->in_memory)
+            {
+                f = it->second.get();
+                enter(f, unique_ptr<PPFile>());
+            }
+            else
+            {
+                unique_ptr<PPFile> main(new PPFile); // 主文件一般不会再被包含，不进缓存
+                main->path = *path;
+                if (!main->buf.open_file(path->c_str()))
+                {
+                    error("cannot open source file " + *path);
+                    return false;
+                }
+                tokenize(*main);
+                f = main.get();
+                enter(f, move(main));
+            }
+        }
+        if (resume)
+        {
+            for (const pair<uint32_t, PPMacro> &m : snap_macros)
+                set_macro(m.first, m.second);
+            once.insert(snap_once.begin(), snap_once.end());
+            replay_at = 0;
+            return true;
+        }
+        for (size_t k = pre.size(); k-- > 0;)
+            enter(pre[k].first.file, move(pre[k].second), pre[k].first.dir);
+        if (!predefs.empty())
+        {
+            unique_ptr<PPFile> cmd(new PPFile);
+            cmd->path = "<command-line>";
+            cmd->text = predefs;
+            cmd->in_memory = true;
+            tokenize(*cmd);
+            PPFile *f = cmd.get();
+            enter(f, move(cmd));
+        }
+        return true;
+    }
+
+    // ---- 扫描与缓存 ----
+
+    // 翻译阶段 2：去掉全部 “\ 换行”（含 “\ \r\n”），记下每处在新文本中的位置；没有续行时不做拷贝
+    static void join_lines(PPFile &f)
+    {
+        const char *data = f.data();
+        size_t n = f.size(), from = 0;
+        f.joined.clear();
+        f.splices.clear();
+        f.lines.reset();
+        for (const char *p = data; (p = (const char *)memchr(p, '\\', data + n - p)) != NULL; p++)
+        {
+            size_t i = p - data;
+            size_t len = data[i + 1] == '\n' ? 2 : data[i + 1] == '\r' && data[i + 2] == '\n' ? 3 : 0; // data[n] 为 '\0'
+            if (len == 0)
+                continue;
+            f.joined.append(data + from, i - from);
+            f.splices.push_back(f.joined.size());
+            from = i + len;
+            p += len - 1;
+        }
+        if (!f.splices.empty())
+            f.joined.append(data + from, n - from);
+    }
+
+    // 从引号 data[i] 开始的字符串或字符常量的结束位置：转义字符跳过，同一行内没有配对的引号时返回 0
+    // 词法规则不接受以转义开头的字符串（"\n"），又允许字符串跨行，都与预处理记号不同，因此另行界定
+    static size_t literal_end(const char *data, size_t n, size_t i)
+    {
+        char quote = data[i];
+        for (i++; i < n && data[i] != quote && data[i] != '\n'; i++)
+            if (data[i] == '\\' && i + 1 < n)
+                i++;
+        return i < n && data[i] == quote ? i + 1 : 0;
+    }
+
+    // 对整个文件做词法分析，记号之间被跳过的字节里找出换行（行首）、'#'、'##' 与其他字符
+    void tokenize(PPFile &f)
+    {
+        f.toks.clear();
+        string warning;
+        if (!check_utf8(f.data(), f.size(), f.path, warning))
+            msgs.push_back(warning);
+        join_lines(f);
+        const char *data = f.lexed();
+        size_t n = f.lexed_size();
+        uint8_t flags = PP_BOL;
+        size_t at = 0;
+        Lexer<> lexer(data, n);
+        Token tok = lexer.next();
+        for (;;)
+        {
+            size_t end = tok.kind == TOKEN_END ? n : tok.offset, lit = 0;
+            for (size_t i = at; i < end && lit == 0; i++)
+            {
+                char c = data[i];
+                if (c == '\n')
+                    flags = PP_BOL;
+                else if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v')
+                    flags |= PP_SPACE;
+                else if ((c == '"' || c == '\'') && (lit = literal_end(data, n, i)) != 0)
+                    end = i; // 词法规则没有接受的字符串、字符常量，见下
+                else
+                {
+                    size_t len = c == '#' && i + 1 < end && data[i + 1] == '#' ? 2 : 1;
+                    push_op(f, data + i, len, i, flags);
+                    i += len - 1;
+                }
+            }
+            if (lit == 0 && tok.kind != TOKEN_END && (tok.text[0] == '"' || tok.text[0] == '\''))
+            {
+                // 词法规则的字符串、字符常量，或不能开始它们时单独的引号
+                lit = literal_end(data, n, end);
+                if (lit == end + tok.text.size())
+                    lit = 0; // 与词法规则一致
+                else if (lit == 0)
+                {
+                    // 同一行内没有配对的引号（如注释之外的撇号），引号单独作为一个记号
+                    push_op(f, data + end, 1, end, flags);
+                    at = end + 1;
+                    lexer.seek(at);
+                    tok = lexer.next();
+                    continue;
+                }
+            }
+            if (lit != 0)
+            {
+                // 按预处理记号的规则界定的字符串、字符常量，词法分析从它之后重新开始
+                PPToken p;
+                p.tok.kind = data[end] == '"' ? CAT_STR : CAT_CHAR;
+                p.tok.code = data[end] == '"' ? 78 : 77;
+                p.tok.text = string_view(data + end, lit - end);
+                p.tok.offset = end;
+                p.tok.sym = SYM_NONE;
+                p.tok.num.type = NUM_NONE;
+                p.hide = 0;
+                p.flags = flags;
+                f.toks.push_back(p);
+                flags = 0;
+                at = lit;
+                lexer.seek(at);
+                tok = lexer.next();
+                continue;
+            }
+            if (tok.kind == TOKEN_END)
+                break;
+            if (tok.kind == CAT_NUM || (tok.text == "." && isdigit((unsigned char)data[tok.offset + 1])))
+            {
+                // 按预处理数的规则延伸（如 1e、0x、.5），词法分析从它之后重新开始
+                size_t e = pp_number_end(data, n, tok.offset);
+                if (e != tok.offset + tok.text.size())
+                {
+                    tok.kind = CAT_NUM;
+                    tok.code = 80;
+                    tok.text = string_view(data + tok.offset, e - tok.offset);
+                    decode_number(tok);
+                    lexer.seek(e);
+                }
+            }
+            at = tok.offset + tok.text.size();
+            if (tok.kind == CAT_COMMENT_LINE || tok.kind == CAT_COMMENT_BLOCK)
+                flags |= PP_SPACE; // 跨行的块注释也只算一个空格，不结束指令行
+            else
+            {
+                if (is_name_kind(tok.kind))
+                    tok.sym = names.intern(tok.text);
+                PPToken p;
+                p.tok = tok;
+                p.hide = 0;
+                p.flags = flags;
+                f.toks.push_back(p);
+                flags = 0;
+            }
+            tok = lexer.next();
+        }
+        f.guard = find_guard(f.toks);
+        f.lazy = false;
+        counts.files_read++;
+    }
+
+    // 从 data[i] 开始的预处理数的结束位置，不是预处理数时返回 i：可选的 '.' 加一个数字开头，
+    // 之后是数字、字母、'_'、'.' 以及紧跟在 e、E、p、P 之后的正负号
+    static size_t pp_number_end(const char *data, size_t n, size_t i)
+    {
+        size_t k = i + (i < n && data[i] == '.');
+        if (k >= n || !isdigit((unsigned char)data[k]))
+            return i;
+        for (k++; k < n; k++)
+            if (!isalnum((unsigned char)data[k]) && data[k] != '_' && data[k] != '.' &&
+                !((data[k] == '+' || data[k] == '-') && ((data[k - 1] | 0x20) == 'e' || (data[k - 1] | 0x20) == 'p')))
+                break;
+        return k;
+    }
+
+    // 词法分析跳过的字节：'#'、'##' 与其他单个字符
+    static void push_op(PPFile &f, const char *text, size_t len, size_t offset, uint8_t &flags)
+    {
+        PPToken p;
+        p.tok.kind = CAT_OP;
+        p.tok.code = 0;
+        p.tok.text = string_view(text, len);
+        p.tok.offset = offset;
+        p.tok.sym = SYM_NONE;
+        p.tok.num.type = NUM_NONE;
+        p.hide = 0;
+        p.flags = flags;
+        f.toks.push_back(p);
+        flags = 0;
+    }
+
+    static bool is_name_kind(int kind) { return kind == CAT_ID || kind == CAT_KEYWORD; }
+
+    // 行首的 '#' 开始一条指令
+    static bool directive_at(const vector<PPToken> &t, size_t i)
+    {
+        return is_hash(t[i]) && (t[i].flags & PP_BOL);
+    }
+
+    // 第 i 个记号所在行之后第一个行首记号的下标
+    static size_t line_end(const vector<PPToken> &t, size_t i)
+    {
+        for (i++; i < t.size() && !(t[i].flags & PP_BOL); i++)
+            ;
+        return i;
+    }
+
+    // 整个文件形如 #ifndef X ... #endif 或 #if !defined X / #if !defined(X) ... #endif，
+    // 其外没有任何记号、中间没有与之同层的 #else/#elif 时返回 X 的编号
+    static uint32_t find_guard(const vector<PPToken> &t)
+    {
+        size_t n = t.size();
+        if (n < 3 || !directive_at(t, 0))
+            return SYM_NONE;
+        size_t first = line_end(t, 0);
+        uint32_t guard = SYM_NONE;
+        if (first == 3 && is(t[1], "ifndef") && is_name(t[2]))
+            guard = t[2].tok.sym;
+        else if (first == 5 && is(t[1], "if") && is(t[2], "!") && is(t[3], "defined") && is_name(t[4]))
+            guard = t[4].tok.sym;
+        else if (first == 7 && is(t[1], "if") && is(t[2], "!") && is(t[3], "defined") && is(t[4], "(") && is_name(t[5]) && is(t[6], ")"))
+            guard = t[5].tok.sym;
+        if (guard == SYM_NONE)
+            return SYM_NONE;
+        int depth = 1;
+        for (size_t i = first; i < n; i++)
+        {
+            if (!directive_at(t, i) || i + 1 >= n || (t[i + 1].flags & PP_BOL))
+                continue;
+            const PPToken &d = t[i + 1];
+            if (is(d, "if") || is(d, "ifdef") || is(d, "ifndef"))
+                depth++;
+            else if ((is(d, "else") || is(d, "elif")) && depth == 1)
+                return SYM_NONE;
+            else if (is(d, "endif") && --depth == 0)
+                return line_end(t, i) == n ? guard : SYM_NONE;
+        }
+        return SYM_NONE;
+    }
+
+    // 候选路径存在时返回 true，key 为规范化的绝对路径，同一文件经不同的相对路径包含时 key 相同
+    static bool locate(const string &path, string &key)
+    {
+#if !defined(_WIN32)
+        char full[PATH_MAX];
+        struct stat st;
+        if (!realpath(path.c_str(), full) || ::stat(full, &st) != 0 || !S_ISREG(st.st_mode))
+            return false;
+        key = full;
+        return true;
+#else
+        ifstream in(path.c_str(), ios::binary);
+        if (!in)
+            return false;
+        key = path;
+        return true;
+#endif
+    }
+
+    // 打开一个候选路径：内存中的文件按原样匹配，磁盘上的文件按规范化路径缓存
+    PPFile *open_candidate(const string &path, unique_ptr<PPFile> &owned)
+    {
+        unordered_map<string, unique_ptr<PPFile>>::iterator it = files.find(path);
+        if (it != files.end() && it->second->in_memory)
+        {
+            if (cache)
+                return it->second.get();
+            owned.reset(new PPFile);
+            owned->path = path;
+            owned->text = it->second->text;
+            owned->in_memory = true;
+            tokenize(*owned);
+            return owned.get();
+        }
+        string key;
+        if (!locate(path, key))
+            return NULL;
+        if (cache && (it = files.find(key)) != files.end())
+            return it->second.get();
+        unique_ptr<PPFile> f(new PPFile);
+        f->path = path;
+        if (!f->buf.open_file(key.c_str()))
+            return NULL;
+        tokenize(*f);
+        if (!cache)
+        {
+            owned = move(f);
+            return owned.get();
+        }
+        PPFile *p = f.get();
+        files[key] = move(f);
+        return p;
+    }
+
+    // 按 #include 的规则查找：引号形式先找当前文件所在目录，再从第 from 个起依次找各搜索路径（#include_next 从
+    // 当前文件所在搜索路径的下一个开始）；结果（含找不到）按查找键缓存
+    Found find_include(const string &name, bool quoted, int from, unique_ptr<PPFile> &owned)
+    {
+        string dir;
+        if (quoted && !frames.empty())
+        {
+            const string &cur = frames.back().file->path;
+            size_t slash = cur.find_last_of("/\\");
+            dir = slash == string::npos ? "" : cur.substr(0, slash + 1);
+        }
+        string lookup = (quoted ? dir : "<" + to_string(from)) + '\0' + name;
+        if (cache)
+        {
+            unordered_map<string, Found>::iterator it = found.find(lookup);
+            if (it != found.end())
+                return it->second;
+        }
+        Found r = {NULL, -1};
+        if (!name.empty() && (name[0] == '/' || name[0] == '\\'))
+            r.file = open_candidate(name, owned);
+        else
+        {
+            if (quoted)
+                r.file = open_candidate(dir + name, owned);
+            for (int i = from; !r.file && i < (int)dirs.size(); i++)
+            {
+                r.file = open_candidate(dirs[i] + (dirs[i].empty() || dirs[i].back() == '/' ? "" : "/") + name, owned);
+                r.dir = i;
+            }
+            if (!r.file)
+                r.dir = -1;
+        }
+        if (cache)
+            found[lookup] = r;
+        return r;
+    }
+
+    void enter(PPFile *f, unique_ptr<PPFile> owned, int dir = -1)
+    {
+        if (f->lazy)
+            tokenize(*f);
+        Frame fr;
+        fr.file = f;
+        fr.dir = dir;
+        fr.pos = 0;
+        fr.cond_base = conds.size();
+        fr.owned = move(owned);
+        fr.line_delta = 0;
+        frames.push_back(move(fr));
+    }
+
+    void leave()
+    {
+        Frame &f = frames.back();
+        if (conds.size() > f.cond_base)
+        {
+            at_file = f.file;
+            at_off = conds[f.cond_base].offset;
+            error("unterminated conditional directive");
+            conds.resize(f.cond_base);
+        }
+        if (f.owned)
+            retired.push_back(move(f.owned)); // 其中定义的宏仍指向它的文本，留到本翻译单元结束
+        frames.pop_back();
+        // 出错位置回到包含它的那一行；弹出的文件可能随 Frame 一起释放，不能再指向它
+        at_file = NULL;
+        if (!frames.empty())
+        {
+            Frame &g = frames.back();
+            at_file = g.file;
+            at_off = g.pos > 0 ? g.file->toks[g.pos - 1].tok.offset : 0;
+        }
+    }
+
+    // ---- 读取记号 ----
+
+    // 取下一个记号并执行途中遇到的指令：先取待重新扫描的记号，再取当前文件的；全部读完时返回 false
+    bool read(PPToken &t)
+    {
+        for (;;)
+        {
+            if (!pending.empty())
+            {
+                t = pending.back();
+                pending.pop_back();
+                return true;
+            }
+            if (frames.empty())
+                return false;
+            Frame &f = frames.back();
+            if (f.pos == f.file->toks.size())
+            {
+                leave();
+                continue;
+            }
+            const PPToken &x = f.file->toks[f.pos++];
+            at_file = f.file;
+            at_off = x.tok.offset;
+            if (directive_at(f.file->toks, f.pos - 1))
+            {
+                directive();
+                continue;
+            }
+            t = x;
+            return true;
+        }
+    }
+
+    // 展开宏时取下一个记号：不执行指令，遇到指令行、文件末尾或 in_list 时待读记号用完即返回 false
+    bool take(PPToken &t)
+    {
+        if (!pending.empty())
+        {
+            t = pending.back();
+            pending.pop_back();
+            return true;
+        }
+        if (in_list > 0 || frames.empty())
+            return false;
+        Frame &f = frames.back();
+        if (f.pos == f.file->toks.size() || directive_at(f.file->toks, f.pos))
+            return false;
+        t = f.file->toks[f.pos++];
+        at_file = f.file;
+        at_off = t.tok.offset;
+        return true;
+    }
+
+    // 下一个记号是否为 '('（函数式宏的名字后面不是 '(' 时不展开）
+    bool next_is_paren()
+    {
+        if (!pending.empty())
+            return is(pending.back(), "(");
+        if (in_list > 0 || frames.empty())
+            return false;
+        Frame &f = frames.back();
+        return f.pos < f.file->toks.size() && !directive_at(f.file->toks, f.pos) && is(f.file->toks[f.pos], "(");
+    }
+
+    // 当前指令行余下的记号
+    vector<PPToken> rest_of_line()
+    {
+        Frame &f = frames.back();
+        size_t end = f.pos;
+        while (end < f.file->toks.size() && !(f.file->toks[end].flags & PP_BOL))
+            end++;
+        vector<PPToken> line(f.file->toks.begin() + f.pos, f.file->toks.begin() + end);
+        f.pos = end;
+        return line;
+    }
+
+    // 跳过条件不成立的一组：停在同层的 #elif、#else、#endif 的 '#' 上，由 read() 接着执行
+    void skip_group()
+    {
+        Frame &f = frames.back();
+        const vector<PPToken> &t = f.file->toks;
+        int depth = 0;
+        for (; f.pos < t.size(); f.pos++)
+        {
+            if (!directive_at(t, f.pos) || f.pos + 1 >= t.size() || (t[f.pos + 1].flags & PP_BOL))
+                continue;
+            const PPToken &d = t[f.pos + 1];
+            if (is(d, "if") || is(d, "ifdef") || is(d, "ifndef"))
+                depth++;
+            else if (is(d, "endif"))
+            {
+                if (depth-- == 0)
+                    return;
+            }
+            else if ((is(d, "elif") || is(d, "else")) && depth == 0)
+                return;
+        }
+    }
+
+    // ---- 指令 ----
+
+    void directive()
+    {
+        Frame &f = frames.back();
+        if (f.pos == f.file->toks.size() || (f.file->toks[f.pos].flags & PP_BOL))
+            return; // 空指令
+        PPToken name = f.file->toks[f.pos++];
+        vector<PPToken> line = rest_of_line();
+        string_view d = name.tok.text;
+        if (d == "define")
+            do_define(line);
+        else if (d == "undef")
+        {
+            if (line.empty() || !is_name(line[0]))
+                error("no macro name given in #undef directive");
+            else if (defined(line[0].tok.sym))
+                macro_of[line[0].tok.sym] = -1;
+        }
+        else if (d == "include" || d == "include_next")
+            do_include(line, d == "include_next");
+        else if (d == "if")
+            push_cond(eval_if(line));
+        else if (d == "ifdef" || d == "ifndef")
+        {
+            if (line.empty() || !is_name(line[0]))
+            {
+                error("no macro name given in #" + string(d) + " directive");
+                push_cond(false);
+            }
+            else
+                push_cond(defined(line[0].tok.sym) == (d == "ifdef"));
+        }
+        else if (d == "elif" || d == "else")
+        {
+            if (conds.size() <= frames.back().cond_base)
+            {
+                error("#" + string(d) + " without #if");
+                return;
+            }
+            Cond &c = conds.back();
+            if (c.else_seen)
+                error("#" + string(d) + " after #else");
+            c.else_seen = c.else_seen || d == "else";
+            if (c.taken)
+                skip_group();
+            else if (d == "else" || eval_if(line))
+                c.taken = true;
+            else
+                skip_group();
+        }
+        else if (d == "endif")
+        {
+            if (conds.size() <= frames.back().cond_base)
+                error("#endif without #if");
+            else
+                conds.pop_back();
+        }
+        else if (d == "error")
+            error("#error " + spell(line));
+        else if (d == "warning")
+            message("warning", "#warning " + spell(line));
+        else if (d == "pragma")
+        {
+            if (!line.empty() && is(line[0], "once"))
+                once.insert(frames.back().file->path);
+        }
+        else if (d == "line")
+            do_line(name, line);
+        else
+            error("invalid preprocessing directive #" + string(d));
+    }
+
+    // #line 行号 ["文件名"]：展开宏之后，下一行的行号改为给定的值，文件名（若有）改为给定的名字
+    void do_line(const PPToken &name, const vector<PPToken> &raw)
+    {
+        vector<PPToken> line = expand_list(raw);
+        uint64_t n = 0;
+        bool ok = !line.empty() && line[0].tok.kind == CAT_NUM;
+        for (size_t k = 0; ok && k < line[0].tok.text.size(); k++)
+        {
+            char c = line[0].tok.text[k];
+            ok = c >= '0' && c <= '9' && (n = n * 10 + (c - '0')) <= 2147483647;
+        }
+        if (!ok || n == 0)
+        {
+            error("\"" + (line.empty() ? string() : string(line[0].tok.text)) + "\" after #line is not a positive integer");
+            return;
+        }
+        if (line.size() >= 2 && line[1].tok.kind != CAT_STR)
+        {
+            error("invalid filename \"" + string(line[1].tok.text) + "\"");
+            return;
+        }
+        if (line.size() > 2)
+            message("warning", "extra tokens at end of #line directive");
+        Frame &f = frames.back();
+        uint64_t last = raw.empty() ? name.tok.offset : raw.back().tok.offset;
+        f.line_delta = (int64_t)n - (int64_t)(f.file->line(last) + 1);
+        if (line.size() >= 2)
+        {
+            string_view q = line[1].tok.text.substr(1, line[1].tok.text.size() - 2);
+            f.name.clear();
+            for (size_t k = 0; k < q.size(); k++)
+                f.name += q[k] == '\\' && k + 1 < q.size() ? q[++k] : q[k];
+        }
+    }
+
+    void push_cond(bool v)
+    {
+        Cond c = {v, false, at_off};
+        conds.push_back(c);
+        if (!v)
+            skip_group();
+    }
+
+    void do_define(const vector<PPToken> &line)
+    {
+        if (line.empty() || !is_name(line[0]))
+        {
+            error("macro names must be identifiers");
+            return;
+        }
+        if (is(line[0], "defined"))
+        {
+            error("\"defined\" cannot be used as a macro name");
+            return;
+        }
+        PPMacro m;
+        m.params = 0;
+        m.function = m.variadic = false;
+        m.builtin = 0;
+        vector<uint32_t> params;
+        size_t i = 1;
+        if (line.size() > 1 && is(line[1], "(") && !(line[1].flags & PP_SPACE))
+        {
+            m.function = true;
+            i = 2;
+            bool ok = false;
+            while (i < line.size())
+            {
+                if (params.empty() && !m.variadic && is(line[i], ")"))
+                {
+                    ok = true;
+                    i++;
+                    break;
+                }
+                if (i + 2 < line.size() && is(line[i], ".") && is(line[i + 1], ".") && is(line[i + 2], "."))
+                {
+                    m.variadic = true;
+                    params.push_back(names.intern("__VA_ARGS__"));
+                    i += 3;
+                }
+                else if (is_name(line[i]))
+                {
+                    if (find(params.begin(), params.end(), line[i].tok.sym) != params.end())
+                    {
+                        error("duplicate macro parameter \"" + string(line[i].tok.text) + "\"");
+                        return;
+                    }
+                    params.push_back(line[i++].tok.sym);
+                }
+                else
+                    break;
+                if (i < line.size() && is(line[i], ")"))
+                {
+                    ok = true;
+                    i++;
+                    break;
+                }
+                if (m.variadic || i >= line.size() || !is(line[i], ","))
+                    break;
+                i++;
+            }
+            if (!ok)
+            {
+                error("expected parameter name or ')' in macro parameter list");
+                return;
+            }
+            m.params = params.size();
+        }
+        m.body.assign(line.begin() + i, line.end());
+        for (size_t k = 0; k < m.body.size(); k++)
+        {
+            PPToken &b = m.body[k];
+            if (is_name(b))
+                for (size_t p = 0; p < params.size(); p++)
+                    if (params[p] == b.tok.sym)
+                    {
+                        b.tok.kind = PP_PARAM;
+                        b.tok.code = p;
+                    }
+        }
+        for (size_t k = 0; k < m.body.size(); k++)
+        {
+            if (m.function && is_hash(m.body[k]) && (k + 1 == m.body.size() || m.body[k + 1].tok.kind != PP_PARAM))
+            {
+                error("'#' is not followed by a macro parameter");
+                return;
+            }
+            if (is_paste(m.body[k]) && (k == 0 || k + 1 == m.body.size()))
+            {
+                error("'##' cannot appear at either end of a macro expansion");
+                return;
+            }
+        }
+        if (!m.body.empty())
+            m.body[0].flags &= ~PP_SPACE;
+        set_macro(line[0].tok.sym, m);
+    }
+
+    void do_include(const vector<PPToken> &raw, bool next)
+    {
+        counts.includes++;
+        vector<PPToken> line = raw;
+        if (!line.empty() && is_name(line[0]))
+            line = expand_list(line); // #include 宏名
+        string name;
+        bool quoted = true, ok = false;
+        if (!line.empty() && line[0].tok.kind == CAT_STR)
+        {
+            name = string(line[0].tok.text.substr(1, line[0].tok.text.size() - 2));
+            ok = true;
+        }
+        else if (!line.empty() && is(line[0], "<"))
+        {
+            quoted = false;
+            size_t gt = 1;
+            while (gt < line.size() && !is(line[gt], ">"))
+                gt++;
+            if (gt < line.size())
+            {
+                ok = true;
+                if (line[0].tok.text.data() + 1 <= line[gt].tok.text.data() && line.size() == raw.size() && is(raw[0], "<"))
+                    name = string(line[0].tok.text.data() + 1, line[gt].tok.text.data()); // 按原文取 <...> 之间的字符
+                else
+                    for (size_t k = 1; k < gt; k++)
+                        name += (k > 1 && (line[k].flags & PP_SPACE) ? " " : "") + string(line[k].tok.text);
+            }
+        }
+        if (!ok || name.empty())
+        {
+            error("#include expects \"FILENAME\" or <FILENAME>");
+            return;
+        }
+        if ((int)frames.size() >= PP_MAX_DEPTH)
+        {
+            error("#include nested depth " + to_string(PP_MAX_DEPTH) + " exceeds maximum");
+            return;
+        }
+        // #include_next：跳过当前文件所在及之前的搜索路径；当前文件不是经搜索路径找到的则同 #include
+        int from = 0;
+        if (next && frames.back().dir >= 0)
+        {
+            from = frames.back().dir + 1;
+            quoted = false;
+        }
+        unique_ptr<PPFile> owned;
+        Found r = find_include(name, quoted, from, owned);
+        PPFile *f = r.file;
+        if (!f)
+        {
+            error(name + ": No such file or directory");
+            return;
+        }
+        if (recording)
+            note_dep(f);
+        if (once.count(f->path) || (cache && f->guard != SYM_NONE && defined(f->guard)))
+        {
+            counts.skipped++;
+            return;
+        }
+        enter(f, move(owned), r.dir);
+    }
+
+    // 指令行的原文拼写，记号之间有空白处补一个空格（#error 与字符串化用）
+    static string spell(const vector<PPToken> &line)
+    {
+        string s;
+        for (size_t i = 0; i < line.size(); i++)
+        {
+            if (i > 0 && (line[i].flags & (PP_SPACE | PP_BOL)))
+                s += ' ';
+            s.append(line[i].tok.text.data(), line[i].tok.text.size());
+        }
+        return s;
+    }
+
+    // ---- 宏展开 ----
+
+    // t 是未被隐藏的宏名、且函数式宏后面跟着实参时，把替换结果放回待读队列并返回 true
+    bool expand(const PPToken &t)
+    {
+        uint32_t sym = t.tok.sym;
+        if (!is_name(t) || !defined(sym) || hides.contains(t.hide, sym))
+            return false;
+        const PPMacro &m = macros[macro_of[sym]];
+        vector<PPToken> out;
+        uint32_t hs;
+        if (m.builtin)
+        {
+            PPToken r;
+            if (m.builtin == PP_LINE)
+                synth(to_string(at_file ? at_line() : 0), r);
+            else
+                r = make_string(at_file ? at_name() : "");
+            out.push_back(r);
+            hs = 0;
+        }
+        else if (!m.function)
+        {
+            out = subst(m, vector<vector<PPToken>>());
+            hs = hides.add(t.hide, sym);
+        }
+        else
+        {
+            if (!next_is_paren())
+                return false;
+            vector<vector<PPToken>> args;
+            PPToken rparen;
+            int got = collect_args(m, t, args, rparen);
+            if (got < 0)
+                return false;
+            if (got == 0)
+                return true;
+            out = subst(m, args);
+            hs = hides.add(hides.meet(t.hide, rparen.hide), sym);
+        }
+        for (PPToken &o : out)
+            o.hide = hides.unite(o.hide, hs);
+        if (!out.empty())
+            out[0].flags = t.flags;
+        pending.insert(pending.end(), out.rbegin(), out.rend());
+        return true;
+    }
+
+    // 读入 '(' 到与之配对的 ')' 之间的实参，按最外层的逗号分开；可变参数部分中的逗号不分开
+    // 成功返回 1，出错返回 0；预展开实参时 ')' 不在实参之内，与 GCC 一样不算调用，退回读过的记号并返回 -1
+    int collect_args(const PPMacro &m, const PPToken &name, vector<vector<PPToken>> &args, PPToken &rparen)
+    {
+        vector<PPToken> seen(1);
+        take(seen[0]); // '('
+        args.assign(1, vector<PPToken>());
+        int depth = 0;
+        PPToken t;
+        for (;;)
+        {
+            if (!take(t))
+            {
+                if (in_list > 0)
+                {
+                    pending.insert(pending.end(), seen.rbegin(), seen.rend());
+                    return -1;
+                }
+                error("unterminated argument list invoking macro \"" + string(name.tok.text) + "\"");
+                return 0;
+            }
+            seen.push_back(t);
+            if (is(t, "("))
+                depth++;
+            else if (is(t, ")") && depth-- == 0)
+            {
+                rparen = t;
+                break;
+            }
+            else if (is(t, ",") && depth == 0 && !(m.variadic && (int)args.size() == m.params))
+            {
+                args.push_back(vector<PPToken>());
+                continue;
+            }
+            args.back().push_back(t);
+        }
+        if (m.params == 0 && args.size() == 1 && args[0].empty())
+            args.clear(); // f() 调用无形参的宏
+        if (m.variadic && (int)args.size() == m.params - 1)
+            args.push_back(vector<PPToken>()); // 省略了全部可变实参
+        if ((int)args.size() != m.params)
+        {
+            error("macro \"" + string(name.tok.text) + "\" passed " + to_string(args.size()) + " arguments, but takes " + to_string(m.params));
+            return 0;
+        }
+        return 1;
+    }
+
+    // 用实参替换宏体中的形参：# 之后的形参转成字符串，## 两侧的形参用原样的实参，其余用完全展开后的实参
+    vector<PPToken> subst(const PPMacro &m, const vector<vector<PPToken>> &args)
+    {
+        const vector<PPToken> &body = m.body;
+        vector<vector<PPToken>> expanded(args.size());
+        vector<bool> done(args.size(), false);
+        vector<PPToken> out;
+        bool empty_lhs = false; // ## 左侧是空实参
+        for (size_t i = 0; i < body.size(); i++)
+        {
+            const PPToken &b = body[i];
+            if (is_hash(b) && i + 1 < body.size() && body[i + 1].tok.kind == PP_PARAM)
+            {
+                PPToken s = stringize(args[body[++i].tok.code]);
+                s.flags = b.flags;
+                out.push_back(s);
+                empty_lhs = false;
+                continue;
+            }
+            // GNU 扩展 , ## __VA_ARGS__：可变实参为空时连逗号一起去掉
+            if (m.variadic && is(b, ",") && i + 2 < body.size() && is_paste(body[i + 1]) && body[i + 2].tok.kind == PP_PARAM &&
+                body[i + 2].tok.code == m.params - 1)
+            {
+                const vector<PPToken> &va = args[m.params - 1];
+                if (!va.empty())
+                {
+                    out.push_back(b);
+                    out.insert(out.end(), va.begin(), va.end());
+                }
+                i += 2;
+                empty_lhs = false;
+                continue;
+            }
+            if (is_paste(b) && i + 1 < body.size())
+            {
+                const PPToken &r = body[++i];
+                vector<PPToken> rhs = r.tok.kind == PP_PARAM ? args[r.tok.code] : vector<PPToken>(1, r);
+                if (rhs.empty())
+                    continue; // 右侧为空实参，左侧不变
+                size_t from = 0;
+                if (!empty_lhs && !out.empty())
+                {
+                    PPToken pasted;
+                    if (paste(out.back(), rhs[0], pasted))
+                    {
+                        out.back() = pasted;
+                        from = 1;
+                    }
+                    else
+                        error("pasting \"" + string(out.back().tok.text) + "\" and \"" + string(rhs[0].tok.text) +
+                              "\" does not give a valid preprocessing token");
+                }
+                out.insert(out.end(), rhs.begin() + from, rhs.end());
+                empty_lhs = false;
+                continue;
+            }
+            if (b.tok.kind == PP_PARAM)
+            {
+                int k = b.tok.code;
+                if (i + 1 < body.size() && is_paste(body[i + 1]))
+                {
+                    out.insert(out.end(), args[k].begin(), args[k].end());
+                    empty_lhs = args[k].empty();
+                    continue;
+                }
+                if (!done[k])
+                {
+                    expanded[k] = expand_list(args[k]);
+                    done[k] = true;
+                }
+                size_t at = out.size();
+                out.insert(out.end(), expanded[k].begin(), expanded[k].end());
+                if (at < out.size())
+                    out[at].flags = b.flags;
+                empty_lhs = false;
+                continue;
+            }
+            out.push_back(b);
+            empty_lhs = false;
+        }
+        return out;
+    }
+
+    // 把 in 完整展开，不读入 in 之后的任何记号（实参预展开、#if 与 #include 行用）
+    vector<PPToken> expand_list(const vector<PPToken> &in)
+    {
+        vector<PPToken> saved;
+        saved.swap(pending);
+        pending.assign(in.rbegin(), in.rend());
+        in_list++;
+        vector<PPToken> out;
+        PPToken t;
+        while (take(t))
+            if (!expand(t))
+                out.push_back(t);
+        in_list--;
+        pending.swap(saved);
+        return out;
+    }
+
+    // 把 s 拷入文本池后重新做词法分析，整串恰好是一个记号时返回 true；"#"、"##" 与单个其他字符同 tokenize()
+    bool synth(const string &s, PPToken &r)
+    {
+        string_view text = texts.name(texts.intern(s));
+        Lexer<> lexer(text.data(), text.size());
+        Token tok = lexer.next();
+        if (tok.kind == TOKEN_END && (text == "#" || text == "##" || (text.size() == 1 && !isspace((unsigned char)text[0]))))
+        {
+            tok.kind = CAT_OP;
+            tok.text = text;
+            tok.offset = 0;
+        }
+        else if ((tok.kind == TOKEN_END || tok.offset != 0 || tok.text.size() != text.size()) && !text.empty() &&
+                 pp_number_end(text.data(), text.size(), 0) == text.size())
+        {
+            // 词法规则不接受的预处理数（如 . 与 5 粘接出的 .5）同 tokenize() 作为一个常数
+            tok.kind = CAT_NUM;
+            tok.code = 80;
+            tok.text = text;
+            tok.offset = 0;
+            tok.sym = SYM_NONE;
+            decode_number(tok);
+        }
+        else if (tok.kind == TOKEN_END || tok.offset != 0 || tok.text.size() != text.size() ||
+                 tok.kind == CAT_COMMENT_LINE || tok.kind == CAT_COMMENT_BLOCK)
+            return false;
+        if (is_name_kind(tok.kind))
+            tok.sym = names.intern(tok.text);
+        r.tok = tok;
+        r.hide = 0;
+        r.flags = 0;
+        return true;
+    }
+
+    bool paste(const PPToken &l, const PPToken &r, PPToken &out)
+    {
+        if (!synth(string(l.tok.text) + string(r.tok.text), out))
+            return false;
+        out.hide = l.hide;
+        out.flags = l.flags;
+        return true;
+    }
+
+    // # 运算：实参的拼写转成字符串常量，其中字符串、字符常量里的 '"' 与 '\' 加上转义
+    PPToken stringize(const vector<PPToken> &arg)
+    {
+        string q = "\"";
+        for (size_t i = 0; i < arg.size(); i++)
+        {
+            if (i > 0 && (arg[i].flags & (PP_SPACE | PP_BOL)))
+                q += ' ';
+            bool quoted = arg[i].tok.kind == CAT_STR || arg[i].tok.kind == CAT_CHAR;
+            for (char c : arg[i].tok.text)
+            {
+                if (quoted && (c == '"' || c == '\\'))
+                    q += '\\';
+                q += c;
+            }
+        }
+        q += '"';
+        return make_literal(q);
+    }
+
+    // 内容为 s 的字符串常量（__FILE__ 用），'"' 与 '\' 加上转义
+    PPToken make_string(const string &s)
+    {
+        string q = "\"";
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                q += '\\';
+            q += c;
+        }
+        q += '"';
+        return make_literal(q);
+    }
+
+    // 词法规则不接受以转义开头的字符串，字符串常量不经 synth() 而直接构造记号
+    PPToken make_literal(const string &q)
+    {
+        PPToken r;
+        r.tok.kind = CAT_STR;
+        r.tok.code = 78;
+        r.tok.text = texts.name(texts.intern(q));
+        r.tok.offset = 0;
+        r.tok.sym = SYM_NONE;
+        r.tok.num.type = NUM_NONE;
+        r.hide = 0;
+        r.flags = 0;
+        return r;
+    }
+
+    // ---- #if 表达式 ----
+
+    // 先把 defined X、defined(X) 换成 1 或 0，再展开其余的宏，剩下的标识符按 0 计
+    bool eval_if(const vector<PPToken> &line)
+    {
+        vector<PPToken> pre;
+        for (size_t i = 0; i < line.size(); i++)
+        {
+            if (!is(line[i], "defined"))
+            {
+                pre.push_back(line[i]);
+                continue;
+            }
+            bool paren = i + 1 < line.size() && is(line[i + 1], "(");
+            size_t k = i + 1 + paren;
+            if (k >= line.size() || !is_name(line[k]) || (paren && (k + 1 >= line.size() || !is(line[k + 1], ")"))))
+            {
+                error("operator \"defined\" requires an identifier");
+                return false;
+            }
+            PPToken v;
+            synth(defined(line[k].tok.sym) ? "1" : "0", v);
+            pre.push_back(v);
+            i = k + paren;
+        }
+        vector<PPToken> e = expand_list(pre);
+        if (e.empty())
+        {
+            error("#if with no expression");
+            return false;
+        }
+        ex = &e;
+        ei = 0;
+        bad = false;
+        skip = 0;
+        Value v = eval_cond();
+        if (bad || ei != e.size())
+        {
+            error("invalid expression in #if: " + spell(e));
+            return false;
+        }
+        return v.v != 0;
+    }
+
+    bool accept(const char *s)
+    {
+        if (ei < ex->size() && is((*ex)[ei], s))
+        {
+            ei++;
+            return true;
+        }
+        return false;
+    }
+
+    // ?: 只对选中的一支报错；结果的类型按两支的寻常算术转换
+    Value eval_cond()
+    {
+        Value c = eval_binary(1);
+        if (!accept("?"))
+            return c;
+        skip += c.v == 0;
+        Value a = eval_cond();
+        skip -= c.v == 0;
+        if (!accept(":"))
+        {
+            bad = true;
+            return c;
+        }
+        skip += c.v != 0;
+        Value b = eval_cond();
+        skip -= c.v != 0;
+        Value r = c.v ? a : b;
+        r.is_unsigned = a.is_unsigned || b.is_unsigned;
+        return r;
+    }
+
+    static int precedence(const PPToken &t)
+    {
+        static const char *const ops[][4] = {{"||"}, {"&&"}, {"|"}, {"^"}, {"&"}, {"==", "!="},
+                                             {"<", ">", "<=", ">="}, {"<<", ">>"}, {"+", "-"}, {"*", "/", "%"}};
+        if (t.tok.kind != CAT_OP)
+            return 0;
+        for (int p = 0; p < 10; p++)
+            for (int k = 0; k < 4 && ops[p][k]; k++)
+                if (t.tok.text == ops[p][k])
+                    return p + 1;
+        return 0;
+    }
+
+    // 运算按 64 位整数：有一侧为无符号时按无符号（寻常算术转换），移位取左侧的类型，比较与逻辑运算的结果为有符号；
+    // 加减乘按无符号回绕，避免溢出的未定义行为；&& 与 || 左侧已决定结果时右侧只做语法检查
+    Value eval_binary(int min_prec)
+    {
+        Value l = eval_unary();
+        while (ei < ex->size())
+        {
+            int p = precedence((*ex)[ei]);
+            if (p == 0 || p < min_prec)
+                break;
+            string_view op = (*ex)[ei++].tok.text;
+            bool lazy = (op == "&&" && l.v == 0) || (op == "||" && l.v != 0);
+            skip += lazy;
+            Value r = eval_binary(p + 1);
+            skip -= lazy;
+            l = apply(op, l, r);
+        }
+        return l;
+    }
+
+    Value apply(string_view op, Value l, Value r)
+    {
+        bool u = l.is_unsigned || r.is_unsigned;
+        int64_t sl = l.v, sr = r.v;
+        Value v = {0, false};
+        if (op == "||") v.v = l.v || r.v;
+        else if (op == "&&") v.v = l.v && r.v;
+        else if (op == "==") v.v = l.v == r.v;
+        else if (op == "!=") v.v = l.v != r.v;
+        else if (op == "<") v.v = u ? l.v < r.v : sl < sr;
+        else if (op == ">") v.v = u ? l.v > r.v : sl > sr;
+        else if (op == "<=") v.v = u ? l.v <= r.v : sl <= sr;
+        else if (op == ">=") v.v = u ? l.v >= r.v : sl >= sr;
+        else if (op == "<<" || op == ">>")
+        {
+            v.is_unsigned = l.is_unsigned;
+            if (op == "<<") v.v = l.v << (r.v & 63);
+            else v.v = l.is_unsigned ? l.v >> (r.v & 63) : (uint64_t)(sl >> (r.v & 63));
+        }
+        else
+        {
+            v.is_unsigned = u;
+            if (op == "|") v.v = l.v | r.v;
+            else if (op == "^") v.v = l.v ^ r.v;
+            else if (op == "&") v.v = l.v & r.v;
+            else if (op == "+") v.v = l.v + r.v;
+            else if (op == "-") v.v = l.v - r.v;
+            else if (op == "*") v.v = l.v * r.v;
+            else if (r.v == 0 || (!u && sl == INT64_MIN && sr == -1))
+            {
+                if (!skip)
+                    error("division by zero in #if");
+            }
+            else if (u)
+                v.v = op == "/" ? l.v / r.v : l.v % r.v;
+            else
+                v.v = op == "/" ? sl / sr : sl % sr;
+        }
+        return v;
+    }
+
+    // 整数常量带 u 后缀或超出 intmax_t 时为无符号
+    Value eval_unary()
+    {
+        Value v = {0, false};
+        if (ei >= ex->size())
+        {
+            bad = true;
+            return v;
+        }
+        const PPToken &t = (*ex)[ei++];
+        if (t.tok.kind == CAT_NUM)
+        {
+            if (t.tok.num.type != NUM_INT)
+                bad = true;
+            v.v = t.tok.num.u;
+            v.is_unsigned = (t.tok.num.flags & NUM_UNSIGNED) || v.v > (uint64_t)INT64_MAX;
+            return v;
+        }
+        if (t.tok.kind == CAT_CHAR)
+            v.v = char_value(t.tok.text, false);
+        // 词法规则把 L'x'、u'x'、U'x' 分成前缀标识符与字符常量两个记号
+        else if ((is(t, "L") || is(t, "u") || is(t, "U")) && ei < ex->size() && (*ex)[ei].tok.kind == CAT_CHAR &&
+                 !((*ex)[ei].flags & PP_SPACE))
+            v.v = char_value((*ex)[ei++].tok.text, true);
+        else if (is_name(t))
+            v.v = 0;
+        else if (is(t, "+"))
+            v = eval_unary();
+        else if (is(t, "-"))
+        {
+            v = eval_unary();
+            v.v = 0 - v.v;
+        }
+        else if (is(t, "~"))
+        {
+            v = eval_unary();
+            v.v = ~v.v;
+        }
+        else if (is(t, "!"))
+            v.v = eval_unary().v == 0;
+        else if (is(t, "("))
+        {
+            v = eval_cond();
+            if (!accept(")"))
+                bad = true;
+        }
+        else
+            bad = true;
+        return v;
+    }
+
+    // 字符常量 'c' 的值，支持简单转义、八进制与十六进制转义；wide 为宽字符常量，值不截成 char
+    static int64_t char_value(string_view s, bool wide)
+    {
+        if (s.size() < 3)
+            return 0;
+        size_t i = 1;
+        if (s[i] != '\\')
+            return wide ? (unsigned char)s[i] : (signed char)s[i];
+        char c = s[++i];
+        switch (c)
+        {
+        case 'n': return '\n';
+        case 't': return '\t';
+        case 'r': return '\r';
+        case 'a': return '\a';
+        case 'b': return '\b';
+        case 'f': return '\f';
+        case 'v': return '\v';
+        case 'x':
+        {
+            int64_t v = 0;
+            for (i++; i < s.size() && isxdigit((unsigned char)s[i]); i++)
+                v = v * 16 + (isdigit((unsigned char)s[i]) ? s[i] - '0' : (s[i] | 0x20) - 'a' + 10);
+            return wide ? v : (signed char)v;
+        }
+        default:
+            if (c >= '0' && c <= '7')
+            {
+                int64_t v = 0;
+                for (int k = 0; k < 3 && i < s.size() && s[i] >= '0' && s[i] <= '7'; k++, i++)
+                    v = v * 8 + (s[i] - '0');
+                return wide ? v : (signed char)v;
+            }
+            return c; // \\ \' \" \? 等
+        }
+    }
+};
+#endif
@@ -0,0 +1,172 @@
+// 紧凑的内存记号表：记号按列分开存放（结构数组），每个记号平均 4 到 5 字节，而 vector<Token> 每项 56 字节
+//   codes[]    种别码，每个记号 1 字节；语法分析逐个看记号的种别时只读这一列
+//   kinds[]    记号类别 CAT_*，每个记号 1 字节
+//   gaps       与前一个记号结束处的距离，LEB128 变长编码，通常 1 字节
+//   lengths    记号文本长度，LEB128 变长编码，通常 1 字节
+// 每 TOKBUF_BLOCK 个记号记一个检查点，按下标取记号只需从所在块的检查点起解码不到 TOKBUF_BLOCK 项
+// 注释（种别码 79）不进入上面各列，另存在按位置排列的旁表中；空白本来就不是记号，即记号与注释之间余下的字节，
+// 由偏移的间隔隐含，不另外存放
+#ifndef TOKEN_BUFFER_H
+#define TOKEN_BUFFER_H
+#include "LexAnalysis.h"
+#include <algorithm>
+
+const size_t TOKBUF_BLOCK = 64;
+
+// 旁表中的一条注释
+struct TokenNote
+{
+    uint64_t offset; // 首字节在源缓冲区中的偏移
+    uint64_t length;
+    size_t before;   // 位于第 before 个记号之前，即前面共有 before 个记号
+    int kind;        // CAT_COMMENT_LINE 或 CAT_COMMENT_BLOCK
+};
+
+class TokenBuffer
+{
+public:
+    // data 为源缓冲区，取记号时文本指向其中，须在 TokenBuffer 使用期间保持有效
+    explicit TokenBuffer(const char *data = "") : data(data), count(0), last_end(0) {}
+
+    // 作为 Lexer 的 sink 逐个追加记号：Lexer<TokenBuffer> lexer(TokenBuffer(data), data, n)
+    // 记号须按偏移递增给出，与 Lexer 的输出顺序相同
+    void onToken(const Token &tok)
+    {
+        if (tok.kind == CAT_COMMENT_LINE || tok.kind == CAT_COMMENT_BLOCK)
+        {
+            TokenNote note = {tok.offset, tok.text.size(), count, tok.kind};
+            notes.push_back(note);
+            return;
+        }
+        if (count % TOKBUF_BLOCK == 0)
+        {
+            Checkpoint cp = {last_end, gap_bytes.size(), length_bytes.size()};
+            checkpoints.push_back(cp);
+        }
+        code_column.push_back((uint8_t)tok.code);
+        kind_column.push_back((uint8_t)tok.kind);
+        put_varint(gap_bytes, tok.offset - last_end);
+        put_varint(length_bytes, tok.text.size());
+        last_end = tok.offset + tok.text.size();
+        count++;
+    }
+
+    size_t size() const { return count; }
+
+    // 稠密的种别码、类别列，各 size() 个字节
+    const uint8_t *codes() const { return code_column.data(); }
+    const uint8_t *kinds() const { return kind_column.data(); }
+
+    // 注释旁表，按位置排列
+    const vector<TokenNote> &comments() const { return notes; }
+
+    // 紧挨在第 i 个记号之前（与第 i - 1 个记号之间）的注释为 comments() 中的 [first, second)；i 取 size() 时为末尾的注释
+    pair<size_t, size_t> comments_before(size_t i) const
+    {
+        auto lo = lower_bound(notes.begin(), notes.end(), i, [](const TokenNote &n, size_t k) { return n.before < k; });
+        auto hi = upper_bound(lo, notes.end(), i, [](size_t k, const TokenNote &n) { return k < n.before; });
+        return make_pair((size_t)(lo - notes.begin()), (size_t)(hi - notes.begin()));
+    }
+
+    string_view text(const TokenNote &note) const { return string_view(data + note.offset, note.length); }
+
+    // 第 i 个记号，与 Lexer 给出的相同（sym 为 SYM_NONE，常数重新解码）
+    Token token(size_t i) const
+    {
+        const Checkpoint &cp = checkpoints[i / TOKBUF_BLOCK];
+        const uint8_t *g = gap_bytes.data() + cp.gap_pos;
+        const uint8_t *l = length_bytes.data() + cp.length_pos;
+        uint64_t end = cp.end, offset = 0, length = 0;
+        for (size_t k = i - i % TOKBUF_BLOCK; k <= i; k++)
+        {
+            offset = end + get_varint(g);
+            length = get_varint(l);
+            end = offset + length;
+        }
+        return make_token(i, offset, length);
+    }
+
+    // 按顺序把全部记号交给 f(const Token &)，逐个解码两列变长编码，不经过检查点
+    template <typename F>
+    void for_each(F f) const
+    {
+        const uint8_t *g = gap_bytes.data(), *l = length_bytes.data();
+        uint64_t end = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t offset = end + get_varint(g);
+            uint64_t length = get_varint(l);
+            end = offset + length;
+            f(make_token(i, offset, length));
+        }
+    }
+
+    // 各列与旁表实际占用的字节数
+    size_t bytes() const
+    {
+        return code_column.size() + kind_column.size() + gap_bytes.size() + length_bytes.size() +
+               checkpoints.size() * sizeof(Checkpoint) + notes.size() * sizeof(TokenNote);
+    }
+
+private:
+    // 第 k * TOKBUF_BLOCK 个记号处的解码起点
+    struct Checkpoint
+    {
+        uint64_t end;      // 前一个记号的结束处，本块第一个记号的间隔相对于它
+        size_t gap_pos;    // 本块第一个记号的间隔在 gap_bytes 中的位置
+        size_t length_pos; // 本块第一个记号的长度在 length_bytes 中的位置
+    };
+
+    const char *data;
+    vector<uint8_t> code_column, kind_column;
+    vector<uint8_t> gap_bytes, length_bytes;
+    vector<Checkpoint> checkpoints;
+    vector<TokenNote> notes;
+    size_t count;
+    uint64_t last_end;
+
+    static void put_varint(vector<uint8_t> &out, uint64_t v)
+    {
+        while (v >= 0x80)
+        {
+            out.push_back((uint8_t)(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back((uint8_t)v);
+    }
+
+    static uint64_t get_varint(const uint8_t *&p)
+    {
+        if (*p < 0x80)
+            return *p++; // 间隔、长度几乎都小于 128
+        uint64_t v = 0;
+        int shift = 0;
+        while (*p & 0x80)
+        {
+            v |= (uint64_t)(*p++ & 0x7F) << shift;
+            shift += 7;
+        }
+        return v | (uint64_t)*p++ << shift;
+    }
+
+    Token make_token(size_t i, uint64_t offset, uint64_t length) const
+    {
+        Token tok;
+        tok.kind = kind_column[i];
+        tok.code = code_column[i];
+        tok.text = string_view(data + offset, length);
+        tok.offset = offset;
+        tok.sym = SYM_NONE;
+        decode_number(tok);
+        return tok;
+    }
+};
+
+// 分析 data[0, n)（data[n] 须为 '\0'）得到紧凑记号表
+TokenBuffer buffer_tokens(const char *data, size_t n)
+{
+    Lexer<TokenBuffer> lexer(TokenBuffer(data), data, n);
+    lexer.run();
+    return move(lexer.sink());
+}
+#endif
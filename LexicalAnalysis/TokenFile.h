@@ -0,0 +1,159 @@
+// 二进制记号文件 .tok：词法分析一次，之后语法分析、性能测试等可以直接映射记号数组反复使用，不必重新扫描源码
+// 文件布局（主机字节序，目前只在小端机器上生成与读取）：
+//   TokFileHeader                  32 字节
+//   TokRecord[count]               每个记号 24 字节，定长
+//   字符串表[strings]              各记号的文本，相同的文本只存一次，每条后跟一个 '\0'
+// 记号序列与 Lexer::next() 相同：不含空白，注释作为种别码 79 的记号，字符串、字符常量包含两侧引号
+#ifndef TOKEN_FILE_H
+#define TOKEN_FILE_H
+#include "LexAnalysis.h"
+#include "LexInput.h"
+#include "../LineMap.h"
+#include <unordered_map>
+
+const char TOK_FILE_MAGIC[4] = {'C', 'T', 'O', 'K'};
+const uint32_t TOK_FILE_VERSION = 1;
+
+struct TokFileHeader
+{
+    char magic[4];        // "CTOK"
+    uint32_t version;     // TOK_FILE_VERSION
+    uint64_t count;       // 记号数
+    uint64_t source_size; // 源文件字节数
+    uint64_t strings;     // 字符串表字节数
+};
+
+struct TokRecord
+{
+    uint64_t offset; // 首字节在源文件中的偏移
+    uint32_t length; // 文本长度
+    uint32_t text;   // 文本在字符串表中的偏移
+    uint32_t line;   // 首字节所在行号，从 1 开始
+    uint16_t code;   // 种别码
+    uint16_t kind;   // 记号类别 CAT_*
+};
+
+static_assert(sizeof(TokFileHeader) == 32 && sizeof(TokRecord) == 24, "tok file layout");
+
+// 分析 data[0, n)（data[n] 须为 '\0'）并写出 .tok 文件；文本或字符串表超过 4 GB、写入失败时返回 false
+bool write_token_file(const char *path, const char *data, size_t n)
+{
+    vector<TokRecord> recs;
+    string strings;
+    unordered_map<string_view, uint32_t> seen; // 键指向源缓冲区
+    LineMap lines(data, n);
+    const vector<uint64_t> &nl = lines.newlines();
+    size_t k = 0; // 记号按偏移递增，行号沿换行表顺序推进，不必逐个二分
+    Lexer lexer(data, n);
+    for (Token tok = lexer.next(); tok.kind != TOKEN_END; tok = lexer.next())
+    {
+        while (k < nl.size() && nl[k] < tok.offset)
+            k++;
+        if (tok.text.size() > UINT32_MAX || k + 1 > UINT32_MAX)
+            return false;
+        pair<unordered_map<string_view, uint32_t>::iterator, bool> ins = seen.insert(make_pair(tok.text, (uint32_t)strings.size()));
+        if (ins.second)
+        {
+            if (strings.size() + tok.text.size() + 1 > UINT32_MAX)
+                return false;
+            strings.append(tok.text.data(), tok.text.size());
+            strings.push_back('\0');
+        }
+        TokRecord r;
+        r.offset = tok.offset;
+        r.length = tok.text.size();
+        r.text = ins.first->second;
+        r.line = k + 1;
+        r.code = tok.code;
+        r.kind = tok.kind;
+        recs.push_back(r);
+    }
+
+    TokFileHeader h;
+    memcpy(h.magic, TOK_FILE_MAGIC, 4);
+    h.version = TOK_FILE_VERSION;
+    h.count = recs.size();
+    h.source_size = n;
+    h.strings = strings.size();
+    ofstream out(path, ios::binary);
+    out.write((const char *)&h, sizeof(h));
+    out.write((const char *)recs.data(), recs.size() * sizeof(TokRecord));
+    out.write(strings.data(), strings.size());
+    return (bool)out.flush();
+}
+
+// 映射 .tok 文件，记号直接以数组形式访问，不做任何解析
+class TokenFile
+{
+public:
+    TokenFile() : head(NULL), recs(NULL), strs(NULL) {}
+
+    // 打开并校验文件头、各段长度与每条记录，失败返回 false；损坏的文件不会导致越界访问
+    bool open(const char *path)
+    {
+        head = NULL;
+        recs = NULL;
+        strs = NULL;
+        if (!buf.open_file(path) || buf.size() < sizeof(TokFileHeader))
+            return false;
+        const TokFileHeader *h = (const TokFileHeader *)buf.data();
+        if (memcmp(h->magic, TOK_FILE_MAGIC, 4) != 0 || h->version != TOK_FILE_VERSION)
+            return false;
+        size_t body = buf.size() - sizeof(TokFileHeader);
+        if (h->count > body / sizeof(TokRecord) || h->strings != body - h->count * sizeof(TokRecord))
+            return false;
+        const TokRecord *r = (const TokRecord *)(buf.data() + sizeof(TokFileHeader));
+        for (uint64_t i = 0; i < h->count; i++)
+            if (!valid(r[i], *h))
+                return false;
+        head = h;
+        recs = r;
+        strs = (const char *)(recs + h->count);
+        return true;
+    }
+
+    const TokFileHeader &header() const { return *head; }
+    size_t size() const { return head ? head->count : 0; }
+    const TokRecord *begin() const { return recs; }
+    const TokRecord *end() const { return recs + size(); }
+    const TokRecord &operator[](size_t i) const { return recs[i]; }
+
+    string_view text(const TokRecord &r) const { return string_view(strs + r.text, r.length); }
+
+    // 还原为 Lexer 给出的记号，text 指向映射中的字符串表；行号见 (*this)[i].line
+    Token token(size_t i) const
+    {
+        const TokRecord &r = recs[i];
+        Token tok;
+        tok.kind = r.kind;
+        tok.code = r.code;
+        tok.text = text(r);
+        tok.offset = r.offset;
+        tok.sym = SYM_NONE;
+        decode_number(tok);
+        return tok;
+    }
+
+private:
+    // 文本须落在字符串表内、位置须落在源文件内，字符串、字符常量至少含两侧引号
+    static bool valid(const TokRecord &r, const TokFileHeader &h)
+    {
+        if ((uint64_t)r.text + r.length > h.strings || r.offset > h.source_size || r.length > h.source_size - r.offset)
+            return false;
+        return (r.kind != CAT_STR && r.kind != CAT_CHAR) || r.length >= 2;
+    }
+
+    SourceBuffer buf; // 映射整个文件；文件头 8 字节对齐，映射按页对齐，记号数组可直接访问
+    const TokFileHeader *head;
+    const TokRecord *recs;
+    const char *strs;
+};
+
+// 按与 scan() 相同的格式输出 .tok 文件中的全部记号
+void replay_token_file(const TokenFile &file)
+{
+    for (size_t i = 0; i < file.size(); i++)
+        printToken(file.token(i));
+    tokenOut.flush();
+}
+#endif
@@ -0,0 +1,130 @@
+// 记号输出缓冲：先写入大块用户态缓冲区，满了才用一次 write(2) 刷出，整数手工格式化，
+// 取代逐记号 cout << ... << endl 带来的格式化与每记号一次的刷新
+#ifndef TOKEN_WRITER_H
+#define TOKEN_WRITER_H
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <string_view>
+#include <vector>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+using namespace std;
+
+// fd 为 TOKEN_MEMORY 时不写出，输出全部留在缓冲区中由 contents() 取出（并行分析时各块分别格式化）
+const int TOKEN_MEMORY = -2;
+
+class TokenWriter
+{
+public:
+    // fd 为 -1 时丢弃所有输出（性能测试用）
+    explicit TokenWriter(int fd = 1, size_t capacity = 1 << 20) : fd(fd), buf(capacity), used(0), tsv_mode(false) {}
+    ~TokenWriter() { flush(); }
+
+    void set_fd(int new_fd)
+    {
+        flush();
+        fd = new_fd;
+    }
+
+    // 记号的输出格式：为真时每个记号一行 “种别码\t文本”（--tsv），否则为 “序号: <文本,种别码>”
+    void set_tsv(bool on) { tsv_mode = on; }
+    bool tsv() const { return tsv_mode; }
+
+    void put(char c)
+    {
+        if (used == buf.size())
+            make_room(1);
+        buf[used++] = c;
+    }
+
+    void put(string_view s)
+    {
+        if (s.size() > buf.size() - used)
+        {
+            if (fd == TOKEN_MEMORY)
+                make_room(s.size());
+            else
+            {
+                flush();
+                if (s.size() >= buf.size())
+                {
+                    write_all(s.data(), s.size()); // 超过缓冲区的长文本直接写出
+                    return;
+                }
+            }
+        }
+        memcpy(&buf[used], s.data(), s.size());
+        used += s.size();
+    }
+
+    void put_uint(uint64_t v)
+    {
+        char tmp[20];
+        int k = 20;
+        do
+        {
+            tmp[--k] = (char)('0' + v % 10);
+            v /= 10;
+        } while (v != 0);
+        put(string_view(tmp + k, 20 - k));
+    }
+
+    void flush()
+    {
+        if (fd == TOKEN_MEMORY)
+            return;
+        write_all(&buf[0], used);
+        used = 0;
+    }
+
+    // TOKEN_MEMORY 模式下已格式化的全部输出，clear() 清空后缓冲区留作下次使用
+    string_view contents() const { return string_view(&buf[0], used); }
+    void clear() { used = 0; }
+
+private:
+    int fd;
+    vector<char> buf;
+    size_t used;
+    bool tsv_mode;
+
+    // 缓冲区放不下 k 个字节：内存模式下扩容，否则先刷出
+    void make_room(size_t k)
+    {
+        if (fd != TOKEN_MEMORY)
+        {
+            flush();
+            return;
+        }
+        buf.resize(buf.size() * 2 + k);
+    }
+
+    void write_all(const char *p, size_t n)
+    {
+        if (fd < 0)
+            return;
+        while (n > 0)
+        {
+#if defined(_WIN32)
+            int got = _write(fd, p, n > (1u << 30) ? (1u << 30) : (unsigned)n);
+#else
+            ssize_t got = ::write(fd, p, n);
+#endif
+            if (got < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return; // 输出端已关闭等错误，放弃剩余输出
+            }
+            p += got;
+            n -= got;
+        }
+    }
+
+    TokenWriter(const TokenWriter &);
+    TokenWriter &operator=(const TokenWriter &);
+};
+#endif
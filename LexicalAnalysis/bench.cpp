@@ -0,0 +1,878 @@
+// 词法分析器性能测试：统计每秒处理的记号数
+// 用法: bench [输入文件]，缺省时把 dataset/lexical 下的 .c 文件重复拼接成约 8MB 的输入
+//       bench --adversarial 用未闭合的注释、字符串等构造的输入检查耗时是否随输入线性增长
+//       bench --numbers 在以常数为主的输入上比较记号内解码与 strtod/strtoull 的耗时
+//       bench --pp 在反复包含同一批头文件的翻译单元上比较预处理器有无头文件缓存的耗时
+//       bench --pch 比较新进程（新的 Preprocessor）预处理带大段公共前置头文件的源文件时，使用快照与否的耗时
+//       bench --batch 在数千个小文件上比较逐个 ifstream 读入、pread 预读与 io_uring 批量读入的耗时
+//       bench --interleave [输入文件] 把输入切成 16 段当作互不相关的文件，比较逐段单路扫描与 K 路交错扫描的总吞吐
+//       bench --utf8 [输入文件] 在纯 ASCII 与含大量中文的输入上比较 UTF-8 检查（标量、SSSE3、AVX2）与词法分析的耗时
+// 编译时定义 LEX_DIRECT_CODE 则测试直接编码的扫描器，否则测试表驱动扫描器
+#include "LexAnalysis.h"
+#include "LexParallel.h"
+#include "LexIncremental.h"
+#include "TokenFile.h"
+#include "TokenBuffer.h"
+#include "Preprocessor.h"
+#include "LexBatch.h"
+#include "LexInterleave.h"
+#include "LexUtf8.h"
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+string load_input(int argc, char **argv)
+{
+    string src;
+    if (argc > 1)
+    {
+        ifstream fin(argv[1], ios::binary);
+        stringstream ss;
+        ss << fin.rdbuf();
+        return ss.str();
+    }
+    const char *files[] = {"test1.c", "test2.c", "error_test1.c", "error_test2.c"};
+    for (const char *f : files)
+    {
+        ifstream fin(string("dataset/lexical/") + f, ios::binary);
+        stringstream ss;
+        ss << fin.rdbuf();
+        src += ss.str();
+    }
+    if (src.empty())
+        return src;
+    string prog;
+    while (prog.size() < (8u << 20))
+        prog += src;
+    return prog;
+}
+
+// 运行 5 次取最短耗时
+template <typename F>
+double best_of_5(F run)
+{
+    double best = 1e30;
+    for (int round = 0; round < 5; round++)
+    {
+        auto t0 = chrono::steady_clock::now();
+        run();
+        auto t1 = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+void report(const char *what, size_t bytes, long tokens, double sec)
+{
+    cout << what << ": " << sec * 1000 << " ms, "
+         << tokens / sec / 1e6 << " M tokens/s, "
+         << bytes / sec / (1 << 20) << " MB/s" << endl;
+}
+
+// 只跑 Lexer，不输出，返回记号数
+long lex_only(const string &prog)
+{
+    Lexer<CountSink> lexer(CountSink(), prog.data(), prog.size());
+    lexer.run();
+    return lexer.sink().tokens;
+}
+
+// 每种模式分别生成 1、2、4、8 MB 的输入，8 MB 的耗时超过 1 MB 的 16 倍即视为非线性
+int adversarial()
+{
+    const char *names[] = {"unterminated /*", "unterminated \"\\\"", "stray /* in code"};
+    const char *units[] = {"/* ", "\\\"", "x = 1; /* y "};
+    const char *heads[] = {"", "\"", ""};
+    bool linear = true;
+    for (int k = 0; k < 3; k++)
+    {
+        double first = 0, sec = 0;
+        for (size_t mb = 1; mb <= 8; mb *= 2)
+        {
+            string prog = heads[k];
+            while (prog.size() < (mb << 20))
+                prog += units[k];
+            long tokens = 0;
+            sec = best_of_5([&] { tokens = lex_only(prog); });
+            if (mb == 1)
+                first = sec;
+            cout << names[k] << ", " << mb << " MB: " << sec * 1000 << " ms, " << tokens << " tokens" << endl;
+        }
+        if (sec > first * 16)
+        {
+            cout << names[k] << ": runtime grows faster than the input" << endl;
+            linear = false;
+        }
+    }
+    cout << (linear ? "adversarial inputs: linear" : "adversarial inputs: NOT linear") << endl;
+    return linear ? 0 : 1;
+}
+
+// 增量分析：随机位置上 1000 次单字符编辑（插入或替换为标识符、数字、空白、运算符字符），只计 edit() 的耗时，
+// 最后与对编辑后缓冲区的完整扫描逐项比对。插入引号或 /* 时最长匹配须读到下一个闭合处才能确定记号，不在此列
+int incremental(string prog)
+{
+    IncrementalLexer inc;
+    double full_sec = best_of_5([&] { inc.lex(prog.data(), prog.size()); });
+
+    const char alphabet[] = "abcxyz019 ;(){}+-=<>\n";
+    uint64_t seed = 88172645463325252ull;
+    vector<double> edit_us;
+    size_t relexed = 0;
+    for (int k = 0; k < 1000; k++)
+    {
+        seed ^= seed << 13, seed ^= seed >> 7, seed ^= seed << 17;
+        size_t at = seed % prog.size();
+        char c = alphabet[(seed >> 32) % (sizeof(alphabet) - 1)];
+        size_t removed = (seed >> 40) & 1;
+        prog.replace(at, removed, 1, c);
+        auto t0 = chrono::steady_clock::now();
+        relexed += inc.edit(prog.data(), prog.size(), at, removed, 1);
+        auto t1 = chrono::steady_clock::now();
+        edit_us.push_back(chrono::duration<double>(t1 - t0).count() * 1e6);
+    }
+    sort(edit_us.begin(), edit_us.end());
+
+    IncrementalLexer ref;
+    ref.lex(prog.data(), prog.size());
+    bool same = ref.size() == inc.size();
+    for (size_t i = 0; same && i < ref.size(); i++)
+    {
+        Token a = ref.token(i), b = inc.token(i);
+        same = a.kind == b.kind && a.code == b.code && a.offset == b.offset && a.text == b.text;
+    }
+    cout << "incremental: full lex " << full_sec * 1000 << " ms, single-char edit median "
+         << edit_us[edit_us.size() / 2] << " us, max " << edit_us.back() << " us ("
+         << (double)relexed / edit_us.size() << " tokens relexed on average), "
+         << (same ? "matches full relex" : "MISMATCH with full relex") << endl;
+    return same ? 0 : 1;
+}
+
+// 记号文件：写出一次 .tok，再映射后反复遍历全部记号，与重新扫描源码比较
+int token_file(const string &prog)
+{
+    const char *path = "bench.tok";
+    auto t0 = chrono::steady_clock::now();
+    if (!write_token_file(path, prog.data(), prog.size()))
+    {
+        cerr << "Cannot write " << path << endl;
+        return 1;
+    }
+    auto t1 = chrono::steady_clock::now();
+
+    TokenFile file;
+    if (!file.open(path))
+    {
+        cerr << "Cannot open " << path << endl;
+        return 1;
+    }
+    uint64_t sum = 0;
+    double replay_sec = best_of_5([&] {
+        for (const TokRecord &r : file)
+            sum += r.code + r.length;
+    });
+    double lex_sec = best_of_5([&] { sum += lex_only(prog); });
+    size_t bytes = sizeof(TokFileHeader) + file.size() * sizeof(TokRecord) + file.header().strings;
+    cout << "token file: " << bytes << " bytes, " << file.header().strings << " bytes of strings, written in "
+         << chrono::duration<double>(t1 - t0).count() * 1000 << " ms" << endl;
+    report("token file replay (best of 5)", file.size() * sizeof(TokRecord), file.size(), replay_sec);
+    report("Lexer rescan (best of 5)", prog.size(), file.size(), lex_sec);
+    remove(path);
+    return sum == 0; // 使用 sum，避免遍历被优化掉
+}
+
+// 标识符驻留：扫描时把标识符驻留到 SymbolPool，与不驻留、以及每个标识符复制成 std::string 再查
+// unordered_map 的做法比较；最后逐个检查编号对应的名字与记号文本一致
+int interning(const string &prog)
+{
+    double plain_sec = best_of_5([&] { lex_only(prog); });
+    SymbolPool pool;
+    long ids = 0;
+    double pool_sec = best_of_5([&] {
+        SymbolPool fresh;
+        Lexer lexer(prog.data(), prog.size(), &fresh);
+        ids = 0;
+        for (Token tok = lexer.next(); tok.kind != TOKEN_END; tok = lexer.next())
+            ids += tok.sym != SYM_NONE;
+        pool = move(fresh);
+    });
+    size_t names = 0;
+    double string_sec = best_of_5([&] {
+        unordered_map<string, uint32_t> table;
+        Lexer lexer(prog.data(), prog.size());
+        for (Token tok = lexer.next(); tok.kind != TOKEN_END; tok = lexer.next())
+            if (tok.kind == CAT_ID)
+                table.insert(make_pair(string(tok.text), (uint32_t)table.size()));
+        names = table.size();
+    });
+
+    bool same = names == pool.size();
+    Lexer lexer(prog.data(), prog.size(), &pool);
+    for (Token tok = lexer.next(); same && tok.kind != TOKEN_END; tok = lexer.next())
+        same = tok.kind == CAT_ID ? tok.sym < names && pool.name(tok.sym) == tok.text : tok.sym == SYM_NONE;
+    same = same && pool.size() == names; // 再扫一遍不应新增名字
+    cout << "interning: " << ids << " identifiers, " << pool.size() << " distinct, arena " << pool.arena_bytes()
+         << " bytes; Lexer " << plain_sec * 1000 << " ms, with SymbolPool " << pool_sec * 1000
+         << " ms, std::string + unordered_map " << string_sec * 1000 << " ms, "
+         << (same ? "ids consistent" : "ID MISMATCH") << endl;
+    return same ? 0 : 1;
+}
+
+// 记号消费者：比较拉取式 next() 循环与 run() 推给 CountSink、VectorSink、PrintSink（写入内存）的耗时；
+// 再让 4 个 Lexer 各带一个 PrintSink 在 4 个线程上同时输出，检查每份都与顺序输出逐字节相同
+int sinks(const string &prog)
+{
+    long pulled = 0;
+    double pull_sec = best_of_5([&] {
+        Lexer lexer(prog.data(), prog.size());
+        pulled = 0;
+        for (Token tok = lexer.next(); tok.kind != TOKEN_END; tok = lexer.next())
+            pulled++;
+    });
+    long counted = 0;
+    double count_sec = best_of_5([&] { counted = lex_only(prog); });
+    size_t collected = 0;
+    double vector_sec = best_of_5([&] {
+        Lexer<VectorSink> lexer(VectorSink(), prog.data(), prog.size());
+        lexer.run();
+        collected = lexer.sink().tokens.size();
+    });
+    TokenWriter expect(TOKEN_MEMORY);
+    double print_sec = best_of_5([&] {
+        expect.clear();
+        Lexer<PrintSink> lexer(PrintSink(expect), prog.data(), prog.size());
+        lexer.run();
+    });
+
+    const int k = 4;
+    vector<unique_ptr<TokenWriter>> outs;
+    vector<thread> pool;
+    for (int t = 0; t < k; t++)
+        outs.push_back(unique_ptr<TokenWriter>(new TokenWriter(TOKEN_MEMORY)));
+    for (int t = 0; t < k; t++)
+        pool.push_back(thread([&, t] {
+            Lexer<PrintSink> lexer(PrintSink(*outs[t]), prog.data(), prog.size());
+            lexer.run();
+        }));
+    for (thread &th : pool)
+        th.join();
+    bool same = pulled == counted && (size_t)counted == collected;
+    for (int t = 0; t < k; t++)
+        same = same && outs[t]->contents() == expect.contents();
+    cout << "sinks: next() loop " << pull_sec * 1000 << " ms, CountSink " << count_sec * 1000 << " ms, VectorSink "
+         << vector_sec * 1000 << " ms, PrintSink " << print_sec * 1000 << " ms; " << k << " concurrent lexers "
+         << (same ? "match sequential output" : "OUTPUT MISMATCH") << endl;
+    return same ? 0 : 1;
+}
+
+// K 路交错扫描全部各段，返回记号总数
+template <int K>
+long interleaved(const vector<string> &parts)
+{
+    InterleavedLexer<CountSink, K> lexer;
+    for (const string &s : parts)
+        lexer.add(s.data(), s.size());
+    lexer.run();
+    long tokens = 0;
+    for (size_t i = 0; i < lexer.size(); i++)
+        tokens += lexer.sink(i).tokens;
+    return tokens;
+}
+
+// 多路交错扫描：输入在换行处切成 16 段，各自带 '\0' 哨兵，当作 16 个互不相关的文件；
+// 逐段用 Lexer 扫描（即 Analysis() 的扫描循环，不格式化输出）与 InterleavedLexer 的 1、2、4、8 路比较总吞吐，
+// 记号总数须相同，4 路时每段的输出还须与单路逐字节相同
+int interleave(const string &prog)
+{
+    const int pieces = 16;
+    vector<string> parts;
+    size_t from = 0;
+    for (int k = 0; k < pieces && from < prog.size(); k++)
+    {
+        size_t to = prog.size();
+        if (k + 1 < pieces)
+        {
+            size_t nl = prog.find('\n', from + prog.size() / pieces);
+            to = nl == string::npos ? prog.size() : nl + 1;
+        }
+        parts.push_back(prog.substr(from, to - from));
+        from = to;
+    }
+
+    long single = 0;
+    double single_sec = best_of_5([&] {
+        single = 0;
+        for (const string &s : parts)
+            single += lex_only(s);
+    });
+    long tokens[4];
+    double sec[4];
+    sec[0] = best_of_5([&] { tokens[0] = interleaved<1>(parts); });
+    sec[1] = best_of_5([&] { tokens[1] = interleaved<2>(parts); });
+    sec[2] = best_of_5([&] { tokens[2] = interleaved<4>(parts); });
+    sec[3] = best_of_5([&] { tokens[3] = interleaved<8>(parts); });
+
+    vector<unique_ptr<TokenWriter>> outs;
+    InterleavedLexer<PrintSink, 4> printer;
+    for (const string &s : parts)
+    {
+        outs.push_back(unique_ptr<TokenWriter>(new TokenWriter(TOKEN_MEMORY)));
+        printer.add(s.data(), s.size(), PrintSink(*outs.back()));
+    }
+    printer.run();
+    bool same = true;
+    for (size_t i = 0; i < parts.size(); i++)
+    {
+        TokenWriter expect(TOKEN_MEMORY);
+        Lexer<PrintSink> lexer(PrintSink(expect), parts[i].data(), parts[i].size());
+        lexer.run();
+        same = same && outs[i]->contents() == expect.contents();
+    }
+    for (int k = 0; k < 4; k++)
+        same = same && tokens[k] == single;
+
+    cout << "interleave: " << parts.size() << " inputs, " << prog.size() << " bytes" << endl;
+    report("single stream (best of 5)", prog.size(), single, single_sec);
+    for (int k = 0, lanes = 1; k < 4; k++, lanes *= 2)
+    {
+        string what = to_string(lanes) + " lanes (best of 5)";
+        report(what.c_str(), prog.size(), tokens[k], sec[k]);
+    }
+    cout << "interleave: " << (same ? "tokens match single stream" : "TOKEN MISMATCH") << endl;
+    return same ? 0 : 1;
+}
+
+// 紧凑记号表：与 vector<Token> 比较每个记号占用的字节数、只看种别码的一趟扫描与顺序取出全部记号的耗时，
+// 并检查取出的记号（按下标或顺序）与 Lexer 给出的非注释记号逐个相同、注释都在旁表中
+int token_buffer(const string &prog)
+{
+    Lexer<VectorSink> lexer(VectorSink(), prog.data(), prog.size());
+    lexer.run();
+    const vector<Token> &all = lexer.sink().tokens;
+    TokenBuffer buf;
+    double build_sec = best_of_5([&] { buf = buffer_tokens(prog.data(), prog.size()); });
+
+    // 语法分析式的扫描：数一遍分号
+    long in_vector = 0, in_column = 0;
+    double vector_sec = best_of_5([&] {
+        in_vector = 0;
+        for (const Token &tok : all)
+            in_vector += tok.code == 53;
+    });
+    double column_sec = best_of_5([&] {
+        in_column = 0;
+        const uint8_t *codes = buf.codes();
+        for (size_t i = 0; i < buf.size(); i++)
+            in_column += codes[i] == 53;
+    });
+    uint64_t sum = 0;
+    double decode_sec = best_of_5([&] {
+        sum = 0;
+        buf.for_each([&](const Token &tok) { sum += tok.offset + tok.text.size(); });
+    });
+
+    size_t k = 0, notes = 0;
+    bool same = in_vector == in_column;
+    buf.for_each([&](const Token &tok) {
+        while (k < all.size() && all[k].code == 79)
+            k++, notes++;
+        same = same && k < all.size() && tok.kind == all[k].kind && tok.code == all[k].code && tok.text == all[k].text &&
+               tok.offset == all[k].offset && tok.num.type == all[k].num.type &&
+               (tok.num.type == NUM_NONE || tok.num.u == all[k].num.u);
+        k++;
+    });
+    notes += all.size() - min(k, all.size());
+    same = same && notes == buf.comments().size() && buf.size() + notes == all.size();
+    for (size_t i = 0, j = 0; same && i < all.size(); i++)
+        if (all[i].code != 79)
+        {
+            if (j % 997 == 0)
+            {
+                Token tok = buf.token(j);
+                same = tok.offset == all[i].offset && tok.text == all[i].text && tok.code == all[i].code;
+            }
+            j++;
+        }
+
+    cout << "token buffer: " << buf.size() << " tokens + " << buf.comments().size() << " comments, "
+         << (double)buf.bytes() / max<size_t>(buf.size(), 1) << " bytes/token (vector<Token> " << sizeof(Token)
+         << "); build " << build_sec * 1000 << " ms, code scan " << column_sec * 1000 << " ms (vector<Token> "
+         << vector_sec * 1000 << " ms), decode all " << decode_sec * 1000 << " ms; "
+         << (same ? "matches Lexer" : "MISMATCH") << endl;
+    return same ? 0 : 1;
+}
+
+// 依次用标量、SSSE3、AVX2 实现检查 prog，打印各自的耗时；返回各实现的结果是否都等于 expect
+bool utf8_levels(const char *what, const string &prog, size_t expect)
+{
+    static const char *names[3] = {"scalar", "SSSE3", "AVX2"};
+    int saved = utf8_simd_level;
+    bool same = true;
+    cout << what << ":";
+    for (int level = 0; level <= saved; level++)
+    {
+        utf8_simd_level = level;
+        size_t bad = 0;
+        double sec = best_of_5([&] { bad = utf8_validate(prog.data(), prog.size()); });
+        same = same && bad == expect;
+        cout << " " << names[level] << " " << sec * 1000 << " ms (" << prog.size() / sec / (1 << 20) << " MB/s)";
+    }
+    utf8_simd_level = saved;
+    cout << endl;
+    return same;
+}
+
+// UTF-8 检查：纯 ASCII 的输入（缺省为 dataset/lexical 的拼接）与约 8 MB 以中文标识符、字符串、注释为主的输入上，
+// 比较各种检查实现与只跑 Lexer 的耗时；含中文的输入中每个中文标识符须是一个记号，并在其中插入非法字节检查报告的位置
+int utf8(const string &ascii)
+{
+    string prog;
+    long expect = 0;
+    for (int k = 0; prog.size() < (8u << 20); k++)
+    {
+        prog += "int 计数_" + to_string(k) + " = 0; // 注释：中文说明 ü\n";
+        prog += "char *s = \"héllo wörld 😀 第" + to_string(k) + "行\";\n";
+        expect += 12;
+    }
+    bool same = utf8_levels("ASCII input", ascii, ascii.size());
+    double ascii_lex = best_of_5([&] { lex_only(ascii); });
+    same = utf8_levels("UTF-8 input", prog, prog.size()) && same;
+    long tokens = 0;
+    double utf8_lex = best_of_5([&] { tokens = lex_only(prog); });
+    same = same && tokens == expect;
+    cout << "Lexer only: ASCII input " << ascii_lex * 1000 << " ms, UTF-8 input " << utf8_lex * 1000 << " ms, "
+         << tokens << " tokens (expect " << expect << ")" << endl;
+
+    // 截断的序列、超长编码、代理区、孤立的后续字节，放在 64 字节块的不同位置
+    const char *bad[] = {"\xE4\xB8", "\xC0\xAF", "\xED\xA0\x80", "\x80", "\xF4\x90\x80\x80", "\xFF"};
+    for (int k = 0; k < 6; k++)
+    {
+        size_t at = prog.size() / 7 * (k + 1) / 64 * 64 + k * 11 % 64;
+        while ((prog[at] & 0xC0) == 0x80)
+            at--; // 插在一个字符的开头
+        string broken = prog.substr(0, at) + bad[k] + prog.substr(at);
+        string what = "broken input " + to_string(k);
+        same = utf8_levels(what.c_str(), broken, at) && same;
+    }
+    cout << (same ? "all implementations agree" : "MISMATCH") << endl;
+    return same ? 0 : 1;
+}
+
+// 常数解码：构造约 8 MB 以十进制整数、十六进制与浮点常数为主的输入，比较 Lexer 生成记号时解码
+// 所有常数与事后对同样的文本调用 strtoull/strtod 的耗时，并逐个比对两者的值
+int numbers()
+{
+    string prog;
+    uint64_t seed = 0x2545F4914F6CDD1Dull;
+    char buf[64];
+    while (prog.size() < (8u << 20))
+    {
+        seed ^= seed << 13, seed ^= seed >> 7, seed ^= seed << 17;
+        switch (seed % 4)
+        {
+        case 0:
+            snprintf(buf, sizeof(buf), "%llu", (unsigned long long)(seed >> (seed >> 58)));
+            break;
+        case 1:
+            snprintf(buf, sizeof(buf), "0x%llXu", (unsigned long long)(seed >> 16));
+            break;
+        case 2:
+            snprintf(buf, sizeof(buf), "%.*f", (int)(seed >> 60) % 8 + 1, (double)(seed >> 40) / 1000);
+            break;
+        default:
+            snprintf(buf, sizeof(buf), "%.17g", (double)(seed >> 11) * 1e-10 * (double)((seed >> 4) % 97 + 1));
+            if (!strchr(buf, '.') && !strchr(buf, 'e'))
+                strcat(buf, ".5");
+        }
+        prog += "x = ";
+        prog += buf;
+        prog += ";\n";
+    }
+
+    vector<Token> nums;
+    double lex_sec = best_of_5([&] {
+        nums.clear();
+        Lexer lexer(prog.data(), prog.size());
+        for (Token tok = lexer.next(); tok.kind != TOKEN_END; tok = lexer.next())
+            if (tok.kind == CAT_NUM)
+                nums.push_back(tok);
+    });
+    uint64_t sum = 0;
+    double decode_sec = best_of_5([&] {
+        for (const Token &tok : nums)
+        {
+            NumValue v;
+            parse_number(tok.text.data(), tok.text.size(), v);
+            sum += v.u;
+        }
+    });
+    double libc_sec = best_of_5([&] {
+        for (const Token &tok : nums)
+        {
+            // 常数后面紧跟 ';'，strtod 与 strtoull 都在常数末尾停下
+            if (tok.num.type == NUM_FLOAT)
+                sum += strtod(tok.text.data(), NULL) > 1;
+            else
+                sum += strtoull(tok.text.data(), NULL, 0);
+        }
+    });
+
+    bool same = true;
+    for (const Token &tok : nums)
+    {
+        double d = strtod(tok.text.data(), NULL);
+        uint64_t u = strtoull(tok.text.data(), NULL, 0);
+        same = same && (tok.num.type == NUM_FLOAT ? memcmp(&d, &tok.num.d, 8) == 0 : tok.num.type == NUM_INT && tok.num.u == u);
+    }
+    cout << "numbers: " << nums.size() << " literals in " << prog.size() << " bytes; Lexer with decoding " << lex_sec * 1000
+         << " ms; decoding alone " << decode_sec * 1000 << " ms (" << decode_sec / nums.size() * 1e9
+         << " ns/literal), strtod/strtoull " << libc_sec * 1000 << " ms (" << libc_sec / nums.size() * 1e9 << " ns/literal), "
+         << (same ? "values match libc" : "VALUE MISMATCH") << endl;
+    return same && sum != 0 ? 0 : 1; // 使用 sum，避免循环被优化掉
+}
+
+// 预处理输出的摘要：记号数与按文本、种别码累积的哈希，用来比对两种方式的输出
+struct DigestSink
+{
+    long long tokens;
+    uint64_t hash;
+    DigestSink() : tokens(0), hash(0) {}
+    void onToken(const Token &tok)
+    {
+        tokens++;
+        for (char c : tok.text)
+            hash = (hash ^ (unsigned char)c) * 0x100000001B3ull;
+        hash = (hash ^ tok.code) * 0x100000001B3ull;
+    }
+};
+
+// 头文件缓存：40 个带守卫的头文件，各自包含 common.h 与前一个头文件，300 个翻译单元各包含全部 40 个；
+// 同一个 Preprocessor 依次处理全部翻译单元（头文件只扫描一次，已定义守卫宏的再包含直接跳过），
+// 与关闭缓存、每次 #include 都重新扫描并走一遍条件编译比较，两者的输出须逐个记号相同
+int preprocess()
+{
+    const int headers = 40, units = 300;
+    Preprocessor cached, plain;
+    plain.set_cache(false);
+    vector<pair<string, string>> files;
+    files.push_back(make_pair(string("common.h"), string("#ifndef COMMON_H\n#define COMMON_H\n"
+                                                          "#define MAX(a, b) ((a) > (b) ? (a) : (b))\n"
+                                                          "#define CAT(a, b) a ## b\n#define STR(x) #x\n"
+                                                          "typedef unsigned long size_t;\n#endif\n")));
+    for (int k = 0; k < headers; k++)
+    {
+        string h = "h" + to_string(k), g = "H" + to_string(k);
+        string text = "#ifndef " + g + "_H\n#define " + g + "_H\n#include \"common.h\"\n";
+        if (k > 0)
+            text += "#include \"h" + to_string(k - 1) + ".h\"\n";
+        for (int j = 0; j < 30; j++)
+        {
+            string n = to_string(j);
+            text += "/* " + h + " item " + n + " */\nint CAT(" + h + "_f, " + n + ")(int a, size_t b);\n";
+            text += "static const char *" + h + "_s" + n + " = STR(" + h + "_" + n + ");\n";
+            text += "#define " + g + "_M" + n + "(x) MAX(x, " + n + ")\n";
+        }
+        files.push_back(make_pair(h + ".h", text + "#endif\n"));
+    }
+    for (int t = 0; t < units; t++)
+    {
+        string text;
+        for (int k = 0; k < headers; k++)
+            text += "#include \"h" + to_string(t % 2 ? headers - 1 - k : k) + ".h\"\n";
+        text += "int tu" + to_string(t) + "(int v) { return H" + to_string(t % headers) + "_M" + to_string(t % 30) + "(v); }\n";
+        files.push_back(make_pair("tu" + to_string(t) + ".c", text));
+    }
+    for (const pair<string, string> &f : files)
+    {
+        cached.add_file(f.first, f.second);
+        plain.add_file(f.first, f.second);
+    }
+
+    vector<DigestSink> a(units), b(units);
+    bool ok = true;
+    auto t0 = chrono::steady_clock::now();
+    for (int t = 0; t < units; t++)
+        ok = cached.run("tu" + to_string(t) + ".c", a[t]) && ok;
+    auto t1 = chrono::steady_clock::now();
+    for (int t = 0; t < units; t++)
+        ok = plain.run("tu" + to_string(t) + ".c", b[t]) && ok;
+    auto t2 = chrono::steady_clock::now();
+
+    bool same = ok;
+    long long tokens = 0;
+    for (int t = 0; t < units; t++)
+    {
+        same = same && a[t].tokens == b[t].tokens && a[t].hash == b[t].hash;
+        tokens += a[t].tokens;
+    }
+    const Preprocessor::Stats &sc = cached.stats(), &sp = plain.stats();
+    cout << "preprocess: " << units << " units, " << tokens << " tokens, " << sc.includes << " #include; cached "
+         << chrono::duration<double>(t1 - t0).count() * 1000 << " ms (" << sc.skipped << " skipped by guard, "
+         << sc.files_read << " files scanned), no cache " << chrono::duration<double>(t2 - t1).count() * 1000 << " ms ("
+         << sp.files_read << " files scanned), " << (same ? "outputs match" : "OUTPUT MISMATCH") << endl;
+    return same ? 0 : 1;
+}
+
+// 预处理快照：磁盘上 60 个带守卫的头文件（每个 80 个宏、40 个声明）由 prelude.h 全部包含，源文件很短，只再包含其中几个；
+// 每轮都新建 Preprocessor，模拟每次启动进程：直接预处理前置头文件与源文件、装入快照后只预处理源文件、
+// 只预处理去掉 #include 的源文件本身（下限）三者比较，前两者的输出须相同；最后改动一个头文件，快照须被判为过期
+int snapshot()
+{
+    char tmp[] = "/tmp/lexpchXXXXXX";
+    if (!mkdtemp(tmp))
+        return 1;
+    string dir = tmp;
+    vector<string> paths;
+    auto put = [&](const string &name, const string &text) {
+        paths.push_back(dir + "/" + name);
+        ofstream(paths.back(), ios::binary) << text;
+    };
+    const int headers = 60, rounds = 50;
+    string prelude = "#pragma once\n";
+    for (int k = 0; k < headers; k++)
+    {
+        string h = "h" + to_string(k), g = "H" + to_string(k);
+        string text = "#ifndef " + g + "_H\n#define " + g + "_H\n";
+        for (int j = 0; j < 40; j++)
+        {
+            string n = to_string(j);
+            text += "/* " + h + " item " + n + " */\n#define " + g + "_M" + n + "(x, ...) ((x) + " + n + ")\n";
+            text += "#define " + g + "_C" + n + " " + n + "u\n";
+            text += "typedef struct " + h + "_s" + n + " { int a[" + g + "_C" + n + " + 1]; } " + h + "_t" + n + ";\n";
+        }
+        put(h + ".h", text + "#endif\n");
+        prelude += "#include \"h" + to_string(k) + ".h\"\n";
+    }
+    put("prelude.h", prelude);
+    string tu = "#include \"prelude.h\"\n", body;
+    for (int k = 0; k < headers; k += 7)
+    {
+        tu += "#include \"h" + to_string(k) + ".h\"\n";
+        body += "int f" + to_string(k) + "(int v) { return H" + to_string(k) + "_M3(v, 1) * H" + to_string(k) + "_C7; }\n";
+    }
+    put("tu.c", tu + body);
+    put("body.c", body);
+    string pch = dir + "/prelude.pch";
+    paths.push_back(pch);
+
+    auto setup = [&](Preprocessor &p, bool with_prelude) {
+        p.add_include_dir(dir);
+        if (with_prelude)
+            p.add_prelude(dir + "/prelude.h");
+    };
+    bool ok;
+    {
+        Preprocessor p;
+        setup(p, true);
+        ok = p.save_snapshot(pch);
+    }
+    DigestSink a, b, c;
+    auto t0 = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        Preprocessor p;
+        setup(p, true);
+        a = DigestSink();
+        ok = p.run(dir + "/tu.c", a) && ok;
+    }
+    auto t1 = chrono::steady_clock::now();
+    long long read = 0;
+    for (int r = 0; r < rounds; r++)
+    {
+        Preprocessor p;
+        setup(p, true);
+        ok = p.load_snapshot(pch) && ok;
+        b = DigestSink();
+        ok = p.run(dir + "/tu.c", b) && ok;
+        read = p.stats().files_read;
+    }
+    auto t2 = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        Preprocessor p;
+        setup(p, false);
+        c = DigestSink();
+        p.run(dir + "/body.c", c);
+    }
+    auto t3 = chrono::steady_clock::now();
+
+    bool same = ok && a.tokens == b.tokens && a.hash == b.hash;
+    string h5 = dir + "/h5.h";
+    ofstream(h5, ios::app) << "#define H5_EXTRA 1\n";
+    bool stale;
+    {
+        Preprocessor p;
+        setup(p, true);
+        stale = !p.load_snapshot(pch);
+    }
+    for (const string &f : paths)
+        remove(f.c_str());
+    rmdir(dir.c_str());
+
+    double ms = 1000.0 / rounds;
+    cout << "snapshot: " << a.tokens << " tokens per run; full " << chrono::duration<double>(t1 - t0).count() * ms
+         << " ms, from snapshot " << chrono::duration<double>(t2 - t1).count() * ms << " ms (" << read
+         << " files scanned), body only " << chrono::duration<double>(t3 - t2).count() * ms << " ms per cold start, "
+         << (same ? "outputs match" : "OUTPUT MISMATCH") << ", " << (stale ? "edit invalidates snapshot" : "STALE SNAPSHOT ACCEPTED")
+         << endl;
+    return same && stale ? 0 : 1;
+}
+
+// 批量读入：临时目录中 5000 个小源文件（数据集的 .c 文件加上编号），读入并分析（CountSink）全部文件。
+// 逐个用 ifstream 打开、read_prog 读入，与 BatchReader 的 pread（多核时由后台线程预读）、io_uring 批量读入比较，记号总数须相同
+int batch()
+{
+    char tmp[] = "/tmp/lexbatchXXXXXX";
+    if (!mkdtemp(tmp))
+        return 1;
+    string dir = tmp;
+    const char *sources[] = {"test1.c", "test2.c", "error_test1.c", "error_test2.c"};
+    vector<string> texts;
+    for (const char *f : sources)
+        for (const char *base : {"../dataset/lexical/", "dataset/lexical/"})
+        {
+            ifstream in(string(base) + f, ios::binary);
+            if (in)
+            {
+                stringstream ss;
+                ss << in.rdbuf();
+                texts.push_back(ss.str());
+                break;
+            }
+        }
+    if (texts.empty())
+        texts.push_back("int main() { return 0; }\n");
+    const int files = 5000;
+    vector<string> paths;
+    for (int k = 0; k < files; k++)
+    {
+        paths.push_back(dir + "/f" + to_string(k) + ".c");
+        ofstream(paths.back(), ios::binary) << "int file_" << k << " = " << k << ";\n" << texts[k % texts.size()];
+    }
+
+    auto lex = [](const char *data, size_t n) {
+        Lexer<CountSink> lexer(CountSink(), data, n);
+        lexer.run();
+        return lexer.sink().tokens;
+    };
+    long long a = 0, b = 0, c = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (const string &p : paths)
+    {
+        ifstream in(p.c_str(), ios::binary);
+        string prog;
+        read_prog(prog, in);
+        a += lex(prog.data(), prog.size());
+    }
+    auto t1 = chrono::steady_clock::now();
+    {
+        BatchReader r(paths, 32, 1 << 16, false);
+        for (const BatchFile *f = r.next(); f; f = r.next())
+            b += lex(f->data, f->size);
+    }
+    auto t2 = chrono::steady_clock::now();
+    bool uring;
+    {
+        BatchReader r(paths, 32);
+        uring = r.uring();
+        for (const BatchFile *f = r.next(); f; f = r.next())
+            c += lex(f->data, f->size);
+    }
+    auto t3 = chrono::steady_clock::now();
+    for (const string &p : paths)
+        remove(p.c_str());
+    rmdir(dir.c_str());
+
+    bool same = a == b && b == c && a > 0;
+    cout << "batch: " << files << " files, " << a << " tokens; ifstream " << chrono::duration<double>(t1 - t0).count() * 1000
+         << " ms, pread " << chrono::duration<double>(t2 - t1).count() * 1000 << " ms, "
+         << (uring ? "io_uring " : "io_uring unavailable, fallback ") << chrono::duration<double>(t3 - t2).count() * 1000
+         << " ms, " << (same ? "token counts match" : "TOKEN COUNT MISMATCH") << endl;
+    return same ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && string(argv[1]) == "--numbers")
+        return numbers();
+    if (argc > 1 && string(argv[1]) == "--pp")
+        return preprocess();
+    if (argc > 1 && string(argv[1]) == "--batch")
+        return batch();
+    if (argc > 1 && string(argv[1]) == "--pch")
+        return snapshot();
+    if (argc > 1 && string(argv[1]) == "--adversarial")
+        return adversarial();
+    if (argc > 1 && string(argv[1]) == "--interleave")
+    {
+        string prog = load_input(argc - 1, argv + 1);
+        return prog.empty() ? 1 : interleave(prog);
+    }
+    if (argc > 1 && string(argv[1]) == "--utf8")
+    {
+        string prog = load_input(argc - 1, argv + 1);
+        return prog.empty() ? 1 : utf8(prog);
+    }
+
+    string prog = load_input(argc, argv);
+    if (prog.empty())
+    {
+        cerr << "No input" << endl;
+        return 1;
+    }
+
+#ifdef LEX_DIRECT_CODE
+    cout << "engine: direct-coded (LexDirect.h)" << endl;
+#else
+    cout << "engine: table-driven (LexTable.h)" << endl;
+#endif
+
+    // 只做最长匹配，不生成记号文本
+    const unsigned char *data = (const unsigned char *)prog.data();
+    size_t n = prog.size();
+    long matched = 0;
+    double match_sec = best_of_5([&] {
+        matched = 0;
+        size_t i = 0;
+        while (i < n)
+        {
+            int cat = 0;
+            size_t len = longest_match(data, i, n, cat);
+            i += len > 0 ? len : 1;
+            matched += len > 0;
+        }
+    });
+
+    // 完整的 Analysis()，记号照常格式化但不写出
+    tokenOut.set_fd(-1);
+    double analysis_sec = best_of_5([&] {
+        istringstream in(prog);
+        tokenCount = 0;
+        Analysis(in);
+    });
+
+    // 并行分析，线程数依次为 2、4、8；耗时取决于测试机的核数
+    double parallel_sec[4] = {0, 0, 0, 0};
+    for (int t = 2, k = 1; t <= 8; t *= 2, k++)
+        parallel_sec[k] = best_of_5([&] {
+            tokenCount = 0;
+            parallel_scan(prog.data(), prog.size(), t);
+        });
+    tokenOut.set_fd(1);
+
+    cout << "input: " << prog.size() << " bytes, " << matched << " lexemes, " << tokenCount << " tokens" << endl;
+    report("match only (best of 5)", prog.size(), matched, match_sec);
+    report("Analysis() (best of 5)", prog.size(), tokenCount, analysis_sec);
+    for (int t = 2, k = 1; t <= 8; t *= 2, k++)
+    {
+        string what = "parallel_scan(" + to_string(t) + " threads) (best of 5)";
+        report(what.c_str(), prog.size(), tokenCount, parallel_sec[k]);
+    }
+    int failed = incremental(prog);
+    failed |= interning(prog);
+    failed |= sinks(prog);
+    failed |= token_buffer(prog);
+    return token_file(prog) || failed;
+}
@@ -1,24 +1,199 @@
 #include "LexAnalysis.h"
-#include <fstream>
+#include "LexInput.h"
+#include "LexStream.h"
+#include "LexParallel.h"
+#include "TokenFile.h"
+#include "Preprocessor.h"
+#include "LexBatch.h"
+#include "LexUtf8.h"
+#include <cstdlib>
 
+// 用法: main [--stats] [--stream[=窗口字节数]] [--jobs[=线程数]] [--tsv] [--tok-out=记号文件 | --tok]
+//            [--pp [-I目录]... [-D宏[=值]]... [--include=头文件]... [--pch=快照 | --pch-out=快照]] [源文件]
+//       main [--tsv] --batch[=在途文件数] 文件或目录...
+//   --stats   在标准错误中输出 DFA 最小化前后的状态数
+//   --stream  流式分析：在固定大小的窗口上扫描，内存占用与文件大小无关（需为可定位的文件）
+//   --jobs    多线程并行分析单个文件，缺省线程数为 CPU 核数，输出与单线程相同
+//   --tsv     每个记号输出一行 “种别码\t文本”，省去序号与括号
+//   --tok-out 不输出记号，改为写出二进制记号文件（见 TokenFile.h）
+//   --tok     输入是 --tok-out 写出的记号文件，不再扫描源码，按原格式输出其中的记号
+//   --pp      先预处理（见 Preprocessor.h）再输出记号，-I 添加 #include 的搜索路径，-D 预定义宏；错误输出到标准错误
+//   --include 在源文件之前预处理的头文件（同 gcc 的 -include）
+//   --pch-out 只预处理 --include 给出的头文件，把宏表与输出记号写成快照，不需要源文件
+//   --pch     使用 --pch-out 写出的快照代替预处理 --include 的头文件；快照已过期（依赖的文件内容或 -D、-I 变了）时照常预处理
+//   --batch   分析多个文件（目录递归取其中全部普通文件）：用 io_uring 批量打开、读入（见 LexBatch.h），
+//             每个文件先输出一行 “==> 路径 <==”，记号从 1 编号；缺省同时在途 32 个文件
+// 源码先检查是否为合法的 UTF-8（见 LexUtf8.h），第一处非法的编码作为警告输出到标准错误，分析照常进行；--stream 不检查
 int main(int argc, char **argv)
 {
-    if (argc > 1)
+    bool stream = false;
+    size_t window = 1 << 20;
+    int jobs = 1;
+    const char *path = NULL;
+    vector<string> inputs;
+    int batch = 0;
+    const char *tok_out = NULL;
+    bool tok_in = false;
+    bool pp = false;
+    const char *pch = NULL;
+    const char *pch_out = NULL;
+    Preprocessor pre;
+    for (int a = 1; a < argc; a++)
     {
-        std::ifstream fin(argv[1]);
-        if (fin)
+        string arg = argv[a];
+        if (arg == "--stats")
         {
-            Analysis(fin);
+            std::cerr << "DFA states: " << LEX_RAW_STATE_COUNT << " -> " << LEX_STATE_COUNT
+                      << ", byte classes: " << LEX_CLASS_COUNT << std::endl;
+        }
+        else if (arg == "--tsv")
+        {
+            tokenOut.set_tsv(true);
+        }
+        else if (arg == "--stream" || arg.compare(0, 9, "--stream=") == 0)
+        {
+            stream = true;
+            if (arg.size() > 9)
+                window = strtoull(arg.c_str() + 9, NULL, 10);
+        }
+        else if (arg.compare(0, 10, "--tok-out=") == 0)
+        {
+            tok_out = argv[a] + 10;
+        }
+        else if (arg == "--tok")
+        {
+            tok_in = true;
+        }
+        else if (arg == "--pp")
+        {
+            pp = true;
+        }
+        else if (arg.compare(0, 10, "--include=") == 0)
+        {
+            pre.add_prelude(arg.substr(10));
+        }
+        else if (arg.compare(0, 6, "--pch=") == 0)
+        {
+            pch = argv[a] + 6;
+        }
+        else if (arg.compare(0, 10, "--pch-out=") == 0)
+        {
+            pch_out = argv[a] + 10;
+        }
+        else if (arg.compare(0, 2, "-I") == 0 && arg.size() > 2)
+        {
+            pre.add_include_dir(arg.substr(2));
+        }
+        else if (arg.compare(0, 2, "-D") == 0 && arg.size() > 2)
+        {
+            pre.define(arg.substr(2));
+        }
+        else if (arg == "--batch" || arg.compare(0, 8, "--batch=") == 0)
+        {
+            batch = arg.size() > 8 ? atoi(arg.c_str() + 8) : 32;
+            if (batch < 1)
+                batch = 1;
+        }
+        else if (arg == "--jobs" || arg.compare(0, 7, "--jobs=") == 0)
+        {
+            jobs = arg.size() > 7 ? atoi(arg.c_str() + 7) : (int)std::thread::hardware_concurrency();
         }
         else
         {
-            std::cerr << "Cannot open file: " << argv[1] << std::endl;
+            path = argv[a];
+            inputs.push_back(path);
+        }
+    }
+
+    if (batch)
+    {
+        vector<string> files;
+        for (const string &in : inputs)
+            list_sources(in, files);
+        return batch_scan(files, batch) == 0 ? 0 : 1;
+    }
+
+    if (tok_in)
+    {
+        TokenFile file;
+        if (!path || !file.open(path))
+        {
+            std::cerr << "Cannot open token file: " << (path ? path : "<stdin>") << std::endl;
+            return 1;
+        }
+        replay_token_file(file);
+        return 0;
+    }
+
+    if (pch_out)
+    {
+        bool ok = pre.save_snapshot(pch_out);
+        for (const string &m : pre.messages())
+            std::cerr << m << std::endl;
+        if (!ok)
+            std::cerr << "Cannot write snapshot: " << pch_out << std::endl;
+        return ok ? 0 : 1;
+    }
+
+    if (pp)
+    {
+        if (pch && !pre.load_snapshot(pch))
+            std::cerr << "Snapshot " << pch << " is out of date or unreadable, ignored" << std::endl;
+        if (!path)
+        {
+            std::cerr << "--pp needs a source file" << std::endl;
+            return 1;
+        }
+        PrintSink sink(tokenOut, tokenCount);
+        bool ok = pre.run(path, sink);
+        tokenCount = sink.count;
+        tokenOut.flush();
+        for (const string &m : pre.messages())
+            std::cerr << m << std::endl;
+        return ok ? 0 : 1;
+    }
+
+    if (stream)
+    {
+        std::ifstream fin;
+        if (path)
+            fin.open(path, ios::binary);
+        if (!fin || fin.seekg(0, ios::end).tellg() < 0)
+        {
+            std::cerr << "Cannot open file for streaming: " << (path ? path : "<stdin>") << std::endl;
+            return 1;
+        }
+        StreamLexer lexer(fin, window);
+        lexer.run();
+        return 0;
+    }
+
+    // 文件直接 mmap 后在映射上扫描，标准输入整块读入
+    SourceBuffer src;
+    if (path)
+    {
+        if (!src.open_file(path))
+        {
+            std::cerr << "Cannot open file: " << path << std::endl;
             return 1;
         }
     }
     else
     {
-        Analysis();
+        src.read_stdin();
+    }
+    string warning;
+    if (!check_utf8(src.data(), src.size(), path ? path : "<stdin>", warning))
+        std::cerr << warning << std::endl;
+    if (tok_out)
+    {
+        if (!write_token_file(tok_out, src.data(), src.size()))
+        {
+            std::cerr << "Cannot write token file: " << tok_out << std::endl;
+            return 1;
+        }
+        return 0;
     }
+    parallel_scan(src.data(), src.size(), jobs);
     return 0;
 }
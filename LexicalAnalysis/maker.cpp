@@ -0,0 +1,965 @@
+// 词法分析器生成工具：读取 c_keys.txt 与 lex_rules.txt，
+// 经 Thompson 构造 NFA -> 子集构造 DFA -> Hopcroft 最小化 -> 等价类压缩，导出为头文件 LexTable.h
+// 用法（在 LexicalAnalysis 目录下运行）: maker [c_keys.txt] [lex_rules.txt]
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <bitset>
+#include <vector>
+#include <string>
+#include <map>
+#include <fstream>
+#include <sstream>
+using namespace std;
+
+void fail(const string &msg)
+{
+    cerr << "maker: " << msg << endl;
+    exit(1);
+}
+
+/* 基于 DFA 表驱动的词法分析器 */
+const int MAX_STATES = 500;
+const int ASCII_SIZE = 256;
+const int LEX_MAX_RANGES = 5; // 自环字节至多分成几个区间来向量化；标识符的 0-9、A-Z、_、a-z 与 0x80 以上恰为 5 个
+
+struct DFA
+{
+    int trans[MAX_STATES][ASCII_SIZE]; // 构造期使用的稠密转移表，扫描时不再访问
+    int accept[MAX_STATES]; // 0 表示非接收态，>0 表示某类记号类别
+    int code[MAX_STATES];   // 接收态对应的最终种别码
+    int state_count;
+
+    // 压缩后的转移表：按字节等价类合并相同的列
+    // byte_class 把 256 个字节映射为等价类编号，ctrans 为 状态数 × 等价类数 的表，
+    // 状态编号用能容纳的最窄整数类型存放，类型最大值表示无转移
+    unsigned char byte_class[ASCII_SIZE];
+    int class_count;
+    vector<uint8_t> ctrans8;   // state_count < 255 时使用
+    vector<uint16_t> ctrans16; // 否则使用
+
+    void init()
+    {
+        memset(trans, -1, sizeof(trans));
+        memset(accept, 0, sizeof(accept));
+        memset(code, 0, sizeof(code));
+        state_count = 1; // 0 号状态作为起始状态
+    }
+
+    int add_state()
+    {
+        if (state_count >= MAX_STATES)
+            fail("too many DFA states");
+        return state_count++;
+    }
+
+    void add_transition(int from, char c, int to)
+    {
+        trans[from][(unsigned char)c] = to;
+    }
+
+    // 两个字节在所有状态下的转移完全相同时属于同一等价类
+    // '\0' 始终单独作为 0 号类：扫描器把它用作输入末尾的哨兵
+    void compress()
+    {
+        int rep[ASCII_SIZE]; // 每个等价类的代表字节
+        rep[0] = 0;
+        byte_class[0] = 0;
+        class_count = 1;
+        for (int c = 1; c < ASCII_SIZE; c++)
+        {
+            int k = 1;
+            for (; k < class_count; k++)
+            {
+                int r = rep[k], s = 0;
+                while (s < state_count && trans[s][c] == trans[s][r])
+                    s++;
+                if (s == state_count)
+                    break;
+            }
+            if (k == class_count)
+                rep[class_count++] = c;
+            byte_class[c] = (unsigned char)k;
+        }
+
+        ctrans8.clear();
+        ctrans16.clear();
+        if (state_count < 255)
+            fill_table(ctrans8);
+        else
+            fill_table(ctrans16);
+    }
+
+    template <typename StateT>
+    void fill_table(vector<StateT> &table)
+    {
+        const StateT none = (StateT)-1;
+        table.assign((size_t)state_count * class_count, none);
+        for (int c = 0; c < ASCII_SIZE; c++)
+        {
+            int k = byte_class[c];
+            for (int s = 0; s < state_count; s++)
+                if (trans[s][c] != -1)
+                    table[(size_t)s * class_count + k] = (StateT)trans[s][c];
+        }
+    }
+
+    // Hopcroft 最小化：按 accept 类别与种别码划分初始块，再按各等价类上的转移不断细分
+    // 需先调用 compress() 得到等价类；返回最小化后的状态数，之后需重新 compress()
+    int minimize()
+    {
+        const int dead = state_count; // 补一个显式的死状态，使转移函数完全
+        const int n = state_count + 1;
+        const int k_count = class_count;
+        int rep[ASCII_SIZE]; // 每个等价类的代表字节
+        for (int c = ASCII_SIZE - 1; c >= 0; c--)
+            rep[byte_class[c]] = c;
+
+        // 逆转移：inv[k][t] 为经等价类 k 转移到 t 的所有状态
+        vector<vector<vector<int> > > inv(k_count, vector<vector<int> >(n));
+        for (int s = 0; s < n; s++)
+            for (int k = 0; k < k_count; k++)
+            {
+                int t = (s == dead || trans[s][rep[k]] == -1) ? dead : trans[s][rep[k]];
+                inv[k][t].push_back(s);
+            }
+
+        // 初始划分：accept 类别与种别码都相同的状态放入同一块，死状态与非接收态同块
+        vector<vector<int> > blocks;
+        vector<int> block_of(n);
+        map<pair<int, int>, int> by_cat;
+        for (int s = 0; s < n; s++)
+        {
+            pair<int, int> cat = (s == dead) ? make_pair(0, 0) : make_pair(accept[s], code[s]);
+            if (!by_cat.count(cat))
+            {
+                by_cat[cat] = blocks.size();
+                blocks.push_back(vector<int>());
+            }
+            block_of[s] = by_cat[cat];
+            blocks[block_of[s]].push_back(s);
+        }
+
+        // 待处理的 (块, 等价类) 对
+        vector<pair<int, int> > work;
+        vector<vector<char> > in_work(blocks.size(), vector<char>(k_count, 0));
+        for (int b = 0; b < (int)blocks.size(); b++)
+            for (int k = 0; k < k_count; k++)
+            {
+                work.push_back(make_pair(b, k));
+                in_work[b][k] = 1;
+            }
+
+        vector<char> marked(n, 0);
+        while (!work.empty())
+        {
+            int a = work.back().first, k = work.back().second;
+            work.pop_back();
+            in_work[a][k] = 0;
+
+            // X = 经 k 转移进入块 a 的状态集合
+            vector<int> x;
+            for (int t : blocks[a])
+                for (int s : inv[k][t])
+                    if (!marked[s])
+                    {
+                        marked[s] = 1;
+                        x.push_back(s);
+                    }
+
+            vector<int> touched;
+            for (int s : x)
+                touched.push_back(block_of[s]);
+            sort(touched.begin(), touched.end());
+            touched.erase(unique(touched.begin(), touched.end()), touched.end());
+
+            for (int y : touched)
+            {
+                vector<int> in_x, out_x;
+                for (int s : blocks[y])
+                    (marked[s] ? in_x : out_x).push_back(s);
+                if (out_x.empty())
+                    continue;
+
+                // 把 y 拆成 y(∩X) 与新块 z(\X)
+                int z = blocks.size();
+                blocks[y] = in_x;
+                blocks.push_back(out_x);
+                in_work.push_back(vector<char>(k_count, 0));
+                for (int s : out_x)
+                    block_of[s] = z;
+
+                for (int d = 0; d < k_count; d++)
+                {
+                    int pick = z;
+                    if (!in_work[y][d] && blocks[y].size() < blocks[z].size())
+                        pick = y;
+                    if (!in_work[pick][d])
+                    {
+                        work.push_back(make_pair(pick, d));
+                        in_work[pick][d] = 1;
+                    }
+                }
+            }
+            for (int s : x)
+                marked[s] = 0;
+        }
+
+        // 重新编号：起始状态所在块为 0，死状态所在块映射为 -1
+        vector<int> new_id(blocks.size(), -1);
+        int count = 0;
+        new_id[block_of[0]] = count++;
+        for (int s = 1; s < state_count; s++)
+            if (block_of[s] != block_of[dead] && new_id[block_of[s]] == -1)
+                new_id[block_of[s]] = count++;
+
+        static int new_trans[MAX_STATES][ASCII_SIZE];
+        int new_accept[MAX_STATES], new_code[MAX_STATES];
+        for (int s = 0; s < state_count; s++)
+        {
+            int id = new_id[block_of[s]];
+            if (id == -1)
+                continue;
+            new_accept[id] = accept[s];
+            new_code[id] = code[s];
+            for (int c = 0; c < ASCII_SIZE; c++)
+                new_trans[id][c] = trans[s][c] == -1 ? -1 : new_id[block_of[trans[s][c]]];
+        }
+
+        memset(trans, -1, sizeof(trans));
+        memset(accept, 0, sizeof(accept));
+        memset(code, 0, sizeof(code));
+        memcpy(trans, new_trans, sizeof(trans[0]) * count);
+        memcpy(accept, new_accept, sizeof(accept[0]) * count);
+        memcpy(code, new_code, sizeof(code[0]) * count);
+        state_count = count;
+        return count;
+    }
+} dfa;
+
+/* ---------- 记号表与规则文件 ---------- */
+
+// c_keys.txt 中的一项：记号文本与种别码
+struct KeyEntry
+{
+    string text;
+    int code;
+};
+vector<KeyEntry> keyword_list;  // 形如标识符的项：关键字
+vector<KeyEntry> operator_list; // 全部由 ASCII 标点组成的项：运算符与界符
+
+bool is_ident_text(const string &s)
+{
+    if (s.empty() || !(isalpha((unsigned char)s[0]) || s[0] == '_'))
+        return false;
+    for (unsigned char c : s)
+        if (!(isalnum(c) || c == '_'))
+            return false;
+    return true;
+}
+
+bool is_punct_text(const string &s)
+{
+    for (unsigned char c : s)
+        if (c >= 0x80 || !ispunct(c))
+            return false;
+    return !s.empty();
+}
+
+void load_keys(const char *path)
+{
+    ifstream in(path);
+    if (!in)
+        fail(string("cannot open ") + path);
+    string line;
+    while (getline(in, line))
+    {
+        istringstream ss(line);
+        KeyEntry e;
+        if (!(ss >> e.text >> e.code))
+            continue;
+        // “常数”“标识符”“/*注释*/”等只是种别码说明，对应的记号由 lex_rules.txt 中的规则产生
+        if (is_ident_text(e.text))
+            keyword_list.push_back(e);
+        else if (is_punct_text(e.text))
+            operator_list.push_back(e);
+    }
+}
+
+// lex_rules.txt 中的一条规则，类别编号为其行序（从 1 开始），越靠前优先级越高
+// code 为该类记号的种别码；{keywords}/{operators} 展开出的字面量各自带有 c_keys.txt 中的种别码
+struct Rule
+{
+    string name;
+    int code;
+    string regex;
+};
+vector<Rule> rules;
+
+void load_rules(const char *path)
+{
+    ifstream in(path);
+    if (!in)
+        fail(string("cannot open ") + path);
+    string line;
+    while (getline(in, line))
+    {
+        while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t'))
+            line.pop_back();
+        size_t b = line.find_first_not_of(" \t");
+        if (b == string::npos || line[b] == '#')
+            continue;
+        istringstream ss(line);
+        Rule r;
+        if (!(ss >> r.name >> r.code))
+            fail("rule without code: " + line);
+        ss >> ws;
+        if (!getline(ss, r.regex) || r.regex.empty())
+            fail("rule without regex: " + line);
+        rules.push_back(r);
+    }
+    if (rules.empty())
+        fail(string("no rules in ") + path);
+}
+
+/* ---------- Thompson 构造 ---------- */
+
+typedef bitset<ASCII_SIZE> ByteSet;
+
+// NFA 的边：eps 为真时是 ε 边，否则在 set 中的字节上转移
+struct NFAEdge
+{
+    int to;
+    bool eps;
+    ByteSet set;
+};
+
+struct NFA
+{
+    vector<vector<NFAEdge> > out;
+    vector<int> accept; // 接收的规则类别，0 表示非接收
+    vector<int> code;   // {keywords}/{operators} 中字面量的结束状态记录其种别码，0 表示无
+    vector<int> rule;   // 状态所属的规则类别
+
+    int add_state()
+    {
+        out.push_back(vector<NFAEdge>());
+        accept.push_back(0);
+        code.push_back(0);
+        rule.push_back(0);
+        return out.size() - 1;
+    }
+
+    void add_eps(int from, int to)
+    {
+        NFAEdge e = {to, true, ByteSet()};
+        out[from].push_back(e);
+    }
+
+    void add_set(int from, int to, const ByteSet &set)
+    {
+        NFAEdge e = {to, false, set};
+        out[from].push_back(e);
+    }
+} nfa;
+
+// NFA 片段：唯一的入口与出口
+struct Frag
+{
+    int start, end;
+};
+
+// 递归下降的正则解析器，边解析边生成 NFA 片段
+// 支持 | * + ? ( ) [...] [^...] . 以及 \n \t \r \xHH 和对元字符的转义，. 匹配任意字节；
+// {operators}/{keywords} 展开为 c_keys.txt 中相应记号的字面量选择
+class RegexParser
+{
+    const string &re;
+    size_t pos;
+
+    void error(const string &msg)
+    {
+        fail("regex /" + re + "/: " + msg);
+    }
+
+    Frag empty()
+    {
+        Frag f = {nfa.add_state(), nfa.add_state()};
+        nfa.add_eps(f.start, f.end);
+        return f;
+    }
+
+    Frag byte_set(const ByteSet &set)
+    {
+        Frag f = {nfa.add_state(), nfa.add_state()};
+        nfa.add_set(f.start, f.end, set);
+        return f;
+    }
+
+    Frag concat(Frag a, Frag b)
+    {
+        nfa.add_eps(a.end, b.start);
+        Frag f = {a.start, b.end};
+        return f;
+    }
+
+    Frag alternate(Frag a, Frag b)
+    {
+        Frag f = {nfa.add_state(), nfa.add_state()};
+        nfa.add_eps(f.start, a.start);
+        nfa.add_eps(f.start, b.start);
+        nfa.add_eps(a.end, f.end);
+        nfa.add_eps(b.end, f.end);
+        return f;
+    }
+
+    Frag literal(const string &s)
+    {
+        Frag f = empty();
+        for (unsigned char c : s)
+        {
+            ByteSet set;
+            set.set(c);
+            f = concat(f, byte_set(set));
+        }
+        return f;
+    }
+
+    Frag key_list(const vector<KeyEntry> &keys)
+    {
+        if (keys.empty())
+            error("empty key list");
+        Frag f = keyword(keys[0]);
+        for (size_t i = 1; i < keys.size(); i++)
+            f = alternate(f, keyword(keys[i]));
+        return f;
+    }
+
+    // 字面量的结束状态带上种别码，接收时直接得到最终种别码
+    Frag keyword(const KeyEntry &key)
+    {
+        Frag f = literal(key.text);
+        nfa.code[f.end] = key.code;
+        return f;
+    }
+
+    int escape()
+    {
+        if (pos >= re.size())
+            error("dangling backslash");
+        char c = re[pos++];
+        if (c == 'n')
+            return '\n';
+        if (c == 't')
+            return '\t';
+        if (c == 'r')
+            return '\r';
+        if (c == 'x')
+        {
+            if (pos + 2 > re.size() || !isxdigit((unsigned char)re[pos]) || !isxdigit((unsigned char)re[pos + 1]))
+                error("bad \\x escape");
+            int v = stoi(re.substr(pos, 2), nullptr, 16);
+            pos += 2;
+            return v;
+        }
+        return (unsigned char)c;
+    }
+
+    int class_char()
+    {
+        if (pos >= re.size())
+            error("unterminated [");
+        char c = re[pos++];
+        return c == '\\' ? escape() : (unsigned char)c;
+    }
+
+    ByteSet char_class()
+    {
+        ByteSet set;
+        bool negate = pos < re.size() && re[pos] == '^';
+        if (negate)
+            pos++;
+        bool first = true;
+        while (pos < re.size() && (re[pos] != ']' || first))
+        {
+            first = false;
+            int lo = class_char(), hi = lo;
+            if (pos + 1 < re.size() && re[pos] == '-' && re[pos + 1] != ']')
+            {
+                pos++;
+                hi = class_char();
+            }
+            if (hi < lo)
+                error("bad range in []");
+            for (int c = lo; c <= hi; c++)
+                set.set(c);
+        }
+        if (pos >= re.size())
+            error("unterminated [");
+        pos++;
+        return negate ? ~set : set;
+    }
+
+    Frag atom()
+    {
+        char c = re[pos++];
+        if (c == '(')
+        {
+            Frag f = alternation();
+            if (pos >= re.size() || re[pos] != ')')
+                error("missing )");
+            pos++;
+            return f;
+        }
+        if (c == '[')
+            return byte_set(char_class());
+        if (c == '.')
+            return byte_set(ByteSet().set());
+        if (c == '{')
+        {
+            size_t e = re.find('}', pos);
+            if (e == string::npos)
+                error("missing }");
+            string name = re.substr(pos, e - pos);
+            pos = e + 1;
+            if (name == "operators")
+                return key_list(operator_list);
+            if (name == "keywords")
+                return key_list(keyword_list);
+            error("unknown list {" + name + "}");
+        }
+        if (c == '*' || c == '+' || c == '?' || c == ')' || c == '|')
+            error(string("unexpected '") + c + "'");
+        ByteSet set;
+        set.set(c == '\\' ? escape() : (unsigned char)c);
+        return byte_set(set);
+    }
+
+    Frag repetition()
+    {
+        Frag f = atom();
+        while (pos < re.size() && (re[pos] == '*' || re[pos] == '+' || re[pos] == '?'))
+        {
+            char op = re[pos++];
+            Frag g = {nfa.add_state(), nfa.add_state()};
+            nfa.add_eps(g.start, f.start);
+            nfa.add_eps(f.end, g.end);
+            if (op != '+')
+                nfa.add_eps(g.start, g.end); // 可以出现 0 次
+            if (op != '?')
+                nfa.add_eps(f.end, f.start); // 可以重复
+            f = g;
+        }
+        return f;
+    }
+
+    Frag sequence()
+    {
+        Frag f = empty();
+        while (pos < re.size() && re[pos] != '|' && re[pos] != ')')
+            f = concat(f, repetition());
+        return f;
+    }
+
+    Frag alternation()
+    {
+        Frag f = sequence();
+        while (pos < re.size() && re[pos] == '|')
+        {
+            pos++;
+            f = alternate(f, sequence());
+        }
+        return f;
+    }
+
+public:
+    RegexParser(const string &r) : re(r), pos(0) {}
+
+    Frag parse()
+    {
+        Frag f = alternation();
+        if (pos != re.size())
+            error("unexpected ')'");
+        return f;
+    }
+};
+
+// 所有规则并联到同一个起始状态上，返回 NFA 起始状态
+int build_nfa()
+{
+    int start = nfa.add_state();
+    for (size_t i = 0; i < rules.size(); i++)
+    {
+        size_t first = nfa.out.size();
+        Frag f = RegexParser(rules[i].regex).parse();
+        nfa.add_eps(start, f.start);
+        nfa.accept[f.end] = i + 1;
+        for (size_t s = first; s < nfa.out.size(); s++)
+            nfa.rule[s] = i + 1;
+    }
+    return start;
+}
+
+/* ---------- 子集构造 ---------- */
+
+void eps_closure(vector<int> &set)
+{
+    vector<char> in(nfa.out.size(), 0);
+    vector<int> stack = set;
+    for (int s : set)
+        in[s] = 1;
+    while (!stack.empty())
+    {
+        int s = stack.back();
+        stack.pop_back();
+        for (const NFAEdge &e : nfa.out[s])
+            if (e.eps && !in[e.to])
+            {
+                in[e.to] = 1;
+                set.push_back(e.to);
+                stack.push_back(e.to);
+            }
+    }
+    sort(set.begin(), set.end());
+}
+
+// 子集构造得到的 DFA 写入 dfa，起始状态为 0；多条规则同时接收时取编号最小（最靠前）的规则
+void subset_construction(int nfa_start)
+{
+    // 先按 NFA 边上的字节集合划分字节等价类，子集构造只需对每个类走一次
+    vector<ByteSet> sets;
+    for (size_t s = 0; s < nfa.out.size(); s++)
+        for (const NFAEdge &e : nfa.out[s])
+            if (!e.eps && find(sets.begin(), sets.end(), e.set) == sets.end())
+                sets.push_back(e.set);
+    map<vector<bool>, int> sig_class;
+    vector<int> rep; // 每个类的代表字节
+    int byte_cls[ASCII_SIZE];
+    for (int c = 0; c < ASCII_SIZE; c++)
+    {
+        vector<bool> sig(sets.size());
+        for (size_t k = 0; k < sets.size(); k++)
+            sig[k] = sets[k][c];
+        if (!sig_class.count(sig))
+        {
+            sig_class[sig] = rep.size();
+            rep.push_back(c);
+        }
+        byte_cls[c] = sig_class[sig];
+    }
+
+    dfa.init();
+    map<vector<int>, int> dstate;
+    vector<vector<int> > todo;
+
+    vector<int> start(1, nfa_start);
+    eps_closure(start);
+    dstate[start] = 0;
+    todo.push_back(start);
+
+    for (size_t d = 0; d < todo.size(); d++)
+    {
+        vector<int> cur = todo[d];
+        int cat = 0;
+        for (int s : cur)
+            if (nfa.accept[s] && (cat == 0 || nfa.accept[s] < cat))
+                cat = nfa.accept[s];
+        dfa.accept[d] = cat;
+        // 种别码：胜出规则中带种别码的字面量结束状态优先，否则取规则的种别码
+        if (cat > 0)
+        {
+            dfa.code[d] = rules[cat - 1].code;
+            for (int s : cur)
+                if (nfa.code[s] && nfa.rule[s] == cat)
+                    dfa.code[d] = nfa.code[s];
+        }
+
+        for (size_t k = 0; k < rep.size(); k++)
+        {
+            vector<int> next;
+            for (int s : cur)
+                for (const NFAEdge &e : nfa.out[s])
+                    if (!e.eps && e.set[rep[k]])
+                        next.push_back(e.to);
+            if (next.empty())
+                continue;
+            sort(next.begin(), next.end());
+            next.erase(unique(next.begin(), next.end()), next.end());
+            eps_closure(next);
+
+            int t;
+            if (dstate.count(next))
+                t = dstate[next];
+            else
+            {
+                t = dfa.add_state();
+                dstate[next] = t;
+                todo.push_back(next);
+            }
+            for (int c = 0; c < ASCII_SIZE; c++)
+                if (byte_cls[c] == (int)k)
+                    dfa.trans[d][c] = t;
+        }
+    }
+}
+
+// 构造 DFA 并最小化、压缩，返回最小化前的状态数
+int build_dfa()
+{
+    subset_construction(build_nfa());
+    int before = dfa.state_count;
+    dfa.compress();
+    dfa.minimize();
+    dfa.compress();
+    return before;
+}
+
+// 输出 C++ 字符串字面量
+string quote(const string &s)
+{
+    string r = "\"";
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+            r += '\\';
+        r += c;
+    }
+    return r + "\"";
+}
+
+void export_keys(ofstream &out, const char *name, const vector<KeyEntry> &keys)
+{
+    out << "constexpr LexKey " << name << "[] = {";
+    for (size_t i = 0; i < keys.size(); i++)
+        out << (i % 8 == 0 ? "\n    " : " ") << "{" << quote(keys[i].text) << ", " << keys[i].code << "},";
+    out << "\n};" << endl;
+    out << "const int " << name << "_COUNT = " << keys.size() << ";" << endl;
+}
+
+// 状态 s 的自环字节（不含 '\0'）按连续区间列出；自环字节少于 min_stay 个或多于 LEX_MAX_RANGES 个区间时不值得向量化，返回空
+vector<pair<int, int> > skip_ranges(int s, int min_stay = 4)
+{
+    vector<pair<int, int> > ranges;
+    int stay = 0;
+    for (int c = 1; c < ASCII_SIZE; c++)
+    {
+        if (dfa.trans[s][c] != s)
+            continue;
+        stay++;
+        if (!ranges.empty() && ranges.back().second == c - 1)
+            ranges.back().second = c;
+        else
+            ranges.push_back(make_pair(c, c));
+    }
+    if (stay < min_stay || ranges.size() > LEX_MAX_RANGES)
+        ranges.clear();
+    return ranges;
+}
+
+// 把压缩后的 DFA 导出为 constexpr 表，运行时无需任何初始化
+void export_table(int raw_states)
+{
+    ofstream out("LexTable.h");
+    const char *state_type = dfa.state_count < 255 ? "uint8_t" : "uint16_t";
+    out << "#ifndef LEX_TABLE_H" << endl;
+    out << "#define LEX_TABLE_H" << endl;
+    out << "// 由 maker.cpp 自动生成，请勿手工修改" << endl;
+    out << "#include <cstdint>" << endl;
+
+    // 记号类别：lex_rules.txt 中的规则按行序编号
+    for (size_t i = 0; i < rules.size(); i++)
+        out << "const int CAT_" << rules[i].name << " = " << i + 1 << ";" << endl;
+
+    // c_keys.txt 中的关键字与运算符种别码
+    out << "struct LexKey { const char *text; int code; };" << endl;
+    export_keys(out, "LEX_KEYWORDS", keyword_list);
+    export_keys(out, "LEX_OPERATORS", operator_list);
+
+    out << "const int LEX_RAW_STATE_COUNT = " << raw_states << ";" << endl; // 最小化前的状态数
+    out << "const int LEX_STATE_COUNT = " << dfa.state_count << ";" << endl;
+    out << "const int LEX_CLASS_COUNT = " << dfa.class_count << ";" << endl;
+    out << "typedef " << state_type << " lex_state_t;" << endl;
+    out << "const lex_state_t LEX_NONE = (lex_state_t)-1;" << endl;
+
+    out << "constexpr unsigned char LEX_BYTE_CLASS[256] = {";
+    for (int c = 0; c < ASCII_SIZE; c++)
+        out << (c % 32 == 0 ? "\n    " : "") << (int)dfa.byte_class[c] << ",";
+    out << "\n};" << endl;
+
+    out << "constexpr lex_state_t LEX_TRANS[LEX_STATE_COUNT][LEX_CLASS_COUNT] = {" << endl;
+    for (int s = 0; s < dfa.state_count; s++)
+    {
+        out << "    {";
+        for (int k = 0; k < dfa.class_count; k++)
+        {
+            int t = dfa.state_count < 255 ? (int)dfa.ctrans8[s * dfa.class_count + k]
+                                          : (int)dfa.ctrans16[s * dfa.class_count + k];
+            if (k == dfa.byte_class[0])
+                t = dfa.state_count < 255 ? 255 : 65535; // '\0' 列一律无转移，真实转移见 LEX_NUL_TRANS
+            out << t << (k + 1 < dfa.class_count ? "," : "");
+        }
+        out << "}," << endl;
+    }
+    out << "};" << endl;
+
+    // 源码中真实出现的 '\0' 的转移，只有在确认不是末尾哨兵后才查此表
+    out << "constexpr lex_state_t LEX_NUL_TRANS[LEX_STATE_COUNT] = {";
+    for (int s = 0; s < dfa.state_count; s++)
+        out << (dfa.trans[s][0] == -1 ? (dfa.state_count < 255 ? 255 : 65535) : dfa.trans[s][0])
+            << (s + 1 < dfa.state_count ? "," : "");
+    out << "};" << endl;
+
+    out << "constexpr unsigned char LEX_ACCEPT[LEX_STATE_COUNT] = {";
+    for (int s = 0; s < dfa.state_count; s++)
+        out << dfa.accept[s] << (s + 1 < dfa.state_count ? "," : "");
+    out << "};" << endl;
+
+    // 接收态的最终种别码，关键字与各运算符在 DFA 中已区分开，扫描后无需再查表
+    out << "constexpr unsigned char LEX_CODE[LEX_STATE_COUNT] = {";
+    for (int s = 0; s < dfa.state_count; s++)
+        out << dfa.code[s] << (s + 1 < dfa.state_count ? "," : "");
+    out << "};" << endl;
+
+    // 非接收状态各占一位，最长匹配的备忘录按位记录“从该状态、该位置出发不会再接收”
+    int fail_bits = 0;
+    for (int s = 0; s < dfa.state_count; s++)
+        fail_bits += dfa.accept[s] == 0;
+    if (fail_bits > 64)
+        fail("too many non-accepting DFA states for LEX_FAIL_BIT");
+    out << "typedef " << (fail_bits <= 8 ? "uint8_t" : fail_bits <= 16 ? "uint16_t" : fail_bits <= 32 ? "uint32_t" : "uint64_t")
+        << " lex_fail_t;" << endl;
+    out << "constexpr lex_fail_t LEX_FAIL_BIT[LEX_STATE_COUNT] = {";
+    for (int s = 0, k = 0; s < dfa.state_count; s++)
+        out << (dfa.accept[s] == 0 ? 1ull << k++ : 0ull) << (s + 1 < dfa.state_count ? "," : "");
+    out << "};" << endl;
+
+    // 自环状态可整段跳过的字节区间，n 为 0 表示不跳过，见 LexSimd.h
+    out << "const int LEX_MAX_RANGES = " << LEX_MAX_RANGES << ";" << endl;
+    out << "struct LexRanges { unsigned char n; unsigned char lo[LEX_MAX_RANGES]; unsigned char hi[LEX_MAX_RANGES]; };" << endl;
+    out << "constexpr LexRanges LEX_SKIP[LEX_STATE_COUNT] = {" << endl;
+    for (int s = 0; s < dfa.state_count; s++)
+    {
+        vector<pair<int, int> > ranges = skip_ranges(s);
+        string lo, hi;
+        for (size_t k = 0; k < ranges.size(); k++)
+        {
+            lo += (k ? "," : "") + to_string(ranges[k].first);
+            hi += (k ? "," : "") + to_string(ranges[k].second);
+        }
+        out << "    {" << ranges.size() << ", {" << lo << "}, {" << hi << "}}," << endl;
+    }
+    out << "};" << endl;
+
+    out << "#endif" << endl;
+    out.close();
+}
+
+// 把 DFA 导出为直接编码的扫描器：每个状态一个标签，按当前字节 switch 跳转，
+// 只有接收态才记录最近一次接收的位置，供定义了 LEX_DIRECT_CODE 的 LexAnalysis.h 使用
+void export_direct()
+{
+    ofstream out("LexDirect.h");
+    out << "#ifndef LEX_DIRECT_H" << endl;
+    out << "#define LEX_DIRECT_H" << endl;
+    out << "// 由 maker.cpp 自动生成，请勿手工修改" << endl;
+    out << "#include <cstddef>" << endl;
+    out << "#include \"LexSimd.h\"" << endl;
+    out << "// 从 data[i] 开始做最长匹配，返回记号长度（0 表示无匹配），cat、code 为接收类别与种别码，stop 为 DFA 停下的位置" << endl;
+    out << "// 要求 data[n] == '\\0'：只有读到 '\\0' 时才检查是否到达末尾" << endl;
+    out << "inline size_t lex_match_direct(const unsigned char *data, size_t i, size_t n, int &cat, int &code, size_t &stop)" << endl;
+    out << "{" << endl;
+    out << "    size_t p = i;" << endl;
+    out << "    size_t last = 0;" << endl;
+    vector<char> targeted(dfa.state_count, 0);
+    for (int s = 0; s < dfa.state_count; s++)
+        for (int c = 0; c < ASCII_SIZE; c++)
+            if (dfa.trans[s][c] != -1)
+                targeted[dfa.trans[s][c]] = 1;
+    for (int s = 0; s < dfa.state_count; s++)
+    {
+        if (targeted[s])
+            out << "s" << s << ":" << endl;
+        if (dfa.accept[s] > 0)
+        {
+            out << "    last = p - i;" << endl;
+            out << "    cat = " << dfa.accept[s] << ";" << endl;
+            out << "    code = " << dfa.code[s] << ";" << endl;
+        }
+
+        // 出现最多的目标放到 default 分支，其余字节逐个列出；'\0' 单独处理
+        map<int, vector<int> > by_target;
+        for (int c = 1; c < ASCII_SIZE; c++)
+            by_target[dfa.trans[s][c]].push_back(c);
+        int common = -1;
+        size_t most = 0;
+        for (map<int, vector<int> >::iterator it = by_target.begin(); it != by_target.end(); ++it)
+            if (it->second.size() > most)
+            {
+                most = it->second.size();
+                common = it->first;
+            }
+        int nul = dfa.trans[s][0];
+        // 注释体、字符串体这类几乎所有字节都自环的状态才整段跳过；
+        // 标识符、空白的短串由 switch 逐字节处理已经足够快，调用跳过函数反而更慢
+        string self_loop = skip_ranges(s, 128).empty() ? "        p++;\n"
+                                                  : "        p = lex_skip(data, p + 1, LEX_SKIP[" + to_string(s) + "]);\n";
+        if (by_target.size() == 1 && common == -1 && nul == -1)
+        {
+            out << "    goto done;" << endl;
+            continue;
+        }
+
+        out << "    switch (data[p])" << endl;
+        out << "    {" << endl;
+        out << "    case 0:" << endl;
+        if (nul == -1)
+            out << "        goto done;" << endl;
+        else
+            out << "        if (p >= n)" << endl
+                << "            goto done;" << endl
+                << "        p++;" << endl
+                << "        goto s" << nul << ";" << endl;
+        for (map<int, vector<int> >::iterator it = by_target.begin(); it != by_target.end(); ++it)
+        {
+            if (it->first == common)
+                continue;
+            const vector<int> &bytes = it->second;
+            for (size_t k = 0; k < bytes.size(); k++)
+                out << (k % 8 == 0 ? "    " : " ") << "case " << bytes[k] << ":" << (k % 8 == 7 || k + 1 == bytes.size() ? "\n" : "");
+            if (it->first == -1)
+                out << "        goto done;" << endl;
+            else
+                out << (it->first == s ? self_loop : "        p++;\n")
+                    << "        goto s" << it->first << ";" << endl;
+        }
+        out << "    default:" << endl;
+        if (common == -1)
+            out << "        goto done;" << endl;
+        else
+            out << (common == s ? self_loop : "        p++;\n")
+                << "        goto s" << common << ";" << endl;
+        out << "    }" << endl;
+    }
+    out << "done:" << endl;
+    out << "    stop = p;" << endl;
+    out << "    return last;" << endl;
+    out << "}" << endl;
+    out << "#endif" << endl;
+    out.close();
+}
+
+int main(int argc, char **argv)
+{
+    load_keys(argc > 1 ? argv[1] : "c_keys.txt");
+    load_rules(argc > 2 ? argv[2] : "lex_rules.txt");
+    int raw_states = build_dfa();
+    export_table(raw_states);
+    export_direct();
+    cout << "LexTable.h and LexDirect.h generated successfully!" << endl;
+    cout << "NFA states: " << nfa.out.size() << ", DFA states: " << raw_states << " -> " << dfa.state_count
+         << ", byte classes: " << dfa.class_count << endl;
+    return 0;
+}
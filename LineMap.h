@@ -0,0 +1,116 @@
+#ifndef LINE_MAP_H
+#define LINE_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "CpuFeatures.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LINE_MAP_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+// 行号表：一次扫描记下缓冲区中全部换行符的偏移，之后任意字节偏移到 (行, 列) 的换算都是二分查找
+// 词法、语法分析的主循环因此不必逐字符维护行号，只在输出诊断或记号位置时才换算
+
+struct LinePos
+{
+    size_t line;   // 从 1 开始
+    size_t column; // 从 1 开始，按字节计
+};
+
+// 把 data[from, n) 中每个 '\n' 的偏移依次追加到 out
+inline void newline_index_scalar(const char *data, size_t n, size_t from, vector<uint64_t> &out)
+{
+    const char *p = data + from, *end = data + n;
+    while ((p = (const char *)memchr(p, '\n', end - p)) != NULL)
+    {
+        out.push_back(p - data);
+        p++;
+    }
+}
+
+#ifdef LINE_MAP_X86
+// 每次比较一整块，得到的位掩码中每个置位对应一个换行符；不足一块的尾部交给标量实现，不会读出缓冲区
+__attribute__((target("sse2"))) inline void newline_index_sse2(const char *data, size_t n, vector<uint64_t> &out)
+{
+    __m128i nl = _mm_set1_epi8('\n');
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        unsigned m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(data + i)), nl));
+        for (; m; m &= m - 1)
+            out.push_back(i + __builtin_ctz(m));
+    }
+    newline_index_scalar(data, n, i, out);
+}
+
+__attribute__((target("avx2"))) inline void newline_index_avx2(const char *data, size_t n, vector<uint64_t> &out)
+{
+    __m256i nl = _mm256_set1_epi8('\n');
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        uint32_t lo = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(data + i)), nl));
+        uint32_t hi = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(data + i + 32)), nl));
+        for (uint64_t m = (uint64_t)hi << 32 | lo; m; m &= m - 1)
+            out.push_back(i + __builtin_ctzll(m));
+    }
+    newline_index_scalar(data, n, i, out);
+}
+#endif
+
+// 0: 标量，1: SSE2，2: AVX2；程序启动时按 CPU 检测一次
+inline int line_map_simd_level = cpu_simd_level();
+
+inline void newline_index(const char *data, size_t n, vector<uint64_t> &out)
+{
+#ifdef LINE_MAP_X86
+    if (line_map_simd_level == 2)
+        return newline_index_avx2(data, n, out);
+    if (line_map_simd_level == 1)
+        return newline_index_sse2(data, n, out);
+#endif
+    newline_index_scalar(data, n, 0, out);
+}
+
+class LineMap
+{
+public:
+    LineMap() {}
+    LineMap(const char *data, size_t n) { build(data, n); }
+
+    void build(const char *data, size_t n)
+    {
+        nl.clear();
+        newline_index(data, n, nl);
+    }
+
+    // offset 所在的行号，即 offset 之前的换行符个数加一；换行符本身属于它结束的那一行
+    size_t line(uint64_t offset) const
+    {
+        return lower_bound(nl.begin(), nl.end(), offset) - nl.begin() + 1;
+    }
+
+    LinePos at(uint64_t offset) const
+    {
+        size_t l = line(offset);
+        uint64_t start = l > 1 ? nl[l - 2] + 1 : 0;
+        LinePos pos = {l, (size_t)(offset - start + 1)};
+        return pos;
+    }
+
+    size_t line_count() const { return nl.size() + 1; }
+
+    // 全部换行符的偏移，按升序排列
+    const vector<uint64_t> &newlines() const { return nl; }
+
+private:
+    vector<uint64_t> nl;
+};
+
+#endif
@@ -0,0 +1,405 @@
+#ifndef NUMBER_LITERAL_H
+#define NUMBER_LITERAL_H
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 数值常量的解码：词法分析匹配出常数后立即算出它的值，之后的阶段不必再用 atoi/atof 重新转换
+// 十进制数字每次按 8 字节一组并行转换（SWAR）；浮点数先走 Clinger 的精确快速路径，
+// 不满足条件时用 Eisel–Lemire 算法（与 fast_float 相同）由 128 位的 5 的幂近似值直接得到正确舍入的结果，
+// 少数无法确定舍入方向的情形以及超过 19 位有效数字的尾数交给 strtod
+
+enum NumType
+{
+    NUM_NONE,  // 不是常数
+    NUM_INT,   // 整数，值在 u 中
+    NUM_FLOAT, // 浮点数，值在 d 中（long double 与 float 后缀也按 double 给出）
+    NUM_BAD    // 整数超出 64 位，或八进制常数中有 8、9
+};
+
+// NumValue::flags
+const uint8_t NUM_UNSIGNED = 1;  // u/U
+const uint8_t NUM_LONG = 2;      // l/L：整数为 long，浮点数为 long double
+const uint8_t NUM_LONG_LONG = 4; // ll/LL
+const uint8_t NUM_FLOAT32 = 8;   // f/F
+const uint8_t NUM_HEX = 16;      // 0x 开头
+const uint8_t NUM_OCTAL = 32;    // 0 开头的多位整数
+
+struct NumValue
+{
+    uint8_t type;  // NumType
+    uint8_t flags; // 后缀与进制
+    union
+    {
+        uint64_t u;
+        double d;
+    };
+};
+
+inline bool is_digit_char(char c) { return c >= '0' && c <= '9'; }
+
+// 8 个字节是否全是 '0'..'9'：高半字节须为 3，且加 6 后不进位到高半字节
+inline bool is_eight_digits(uint64_t w)
+{
+    return ((w & 0xF0F0F0F0F0F0F0F0ull) | (((w + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ==
+           0x3333333333333333ull;
+}
+
+// 把 8 个数字字符（首字符在最低字节）转换为整数：相邻两位、四位、八位依次合并，共三次乘法
+inline uint32_t parse_eight_digits(uint64_t w)
+{
+    w -= 0x3030303030303030ull;
+    w = (w * 10) + (w >> 8);
+    w = (((w & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+         (((w >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >>
+        32;
+    return (uint32_t)w;
+}
+
+// 从 p 起把连续的十进制数字累加进 w（溢出时按 2^64 回绕，由调用者按位数判断），返回第一个非数字的位置
+// 只在 [p, end) 内读取，不依赖缓冲区末尾的哨兵
+inline const char *accumulate_digits(const char *p, const char *end, uint64_t &w)
+{
+    while (end - p >= 8)
+    {
+        uint64_t x;
+        memcpy(&x, p, 8);
+        if (!is_eight_digits(x))
+            break;
+        w = w * 100000000 + parse_eight_digits(x);
+        p += 8;
+    }
+    while (p < end && is_digit_char(*p))
+        w = w * 10 + (*p++ - '0');
+    return p;
+}
+
+// s[0, n) 全是十进制数字且不超过 2^64 - 1 时给出其值
+inline bool parse_decimal_uint(const char *s, size_t n, uint64_t &v)
+{
+    const char *p = s, *end = s + n;
+    if (p == end)
+        return false;
+    while (end - p > 19 && *p == '0')
+        p++; // 多余的前导零
+    uint64_t w = 0;
+    if (end - p <= 19)
+    {
+        if (accumulate_digits(p, end, w) != end)
+            return false;
+        v = w;
+        return true;
+    }
+    for (; p < end; p++)
+        if (!is_digit_char(*p) || __builtin_mul_overflow(w, 10, &w) || __builtin_add_overflow(w, (uint64_t)(*p - '0'), &w))
+            return false;
+    v = w;
+    return true;
+}
+
+// 5^q（q ∈ [-342, 308]）的 128 位近似，最高位为 1，与 fast_float 的表相同：
+// q >= 0 时截断 5^q；q < 0 时取 ⌊2^b / 5^-q⌋ + 1 再截断，-q <= 27 时 b = z + 127，否则 b = 2z + 128，z 为 5^-q 的位数
+// 首次走到 Eisel–Lemire 路径时用多精度整数精确算出，约 650 项
+const int POW5_MIN = -342, POW5_MAX = 308;
+
+class Pow5Table
+{
+public:
+    uint64_t hi[POW5_MAX - POW5_MIN + 1], lo[POW5_MAX - POW5_MIN + 1];
+
+    Pow5Table()
+    {
+        const size_t B = 1728; // 不小于 b 的最大值 2 * 795 + 128
+        Big p(1, 1), x(B / 32 + 1, 0);
+        x.back() = 1u << (B % 32); // x = 2^B，之后逐次除以 5 得到 ⌊2^B / 5^m⌋
+        set(0, p);
+        for (int m = 1; m <= -POW5_MIN; m++)
+        {
+            mul_small(p, 5);
+            div_small(x, 5);
+            if (m <= POW5_MAX)
+                set(m, p);
+            size_t z = bits(p);
+            size_t b = m <= 27 ? z + 127 : 2 * z + 128;
+            Big c = shift_right(x, B - b); // ⌊2^b / 5^m⌋
+            add_one(c);
+            set(-m, c);
+        }
+    }
+
+private:
+    typedef vector<uint32_t> Big; // 低位在前
+
+    static size_t bits(const Big &a)
+    {
+        for (size_t i = a.size(); i-- > 0;)
+            if (a[i])
+                return i * 32 + 32 - __builtin_clz(a[i]);
+        return 0;
+    }
+
+    static void mul_small(Big &a, uint32_t k)
+    {
+        uint64_t carry = 0;
+        for (uint32_t &d : a)
+        {
+            uint64_t t = (uint64_t)d * k + carry;
+            d = (uint32_t)t;
+            carry = t >> 32;
+        }
+        if (carry)
+            a.push_back((uint32_t)carry);
+    }
+
+    static void div_small(Big &a, uint32_t k)
+    {
+        uint64_t rem = 0;
+        for (size_t i = a.size(); i-- > 0;)
+        {
+            uint64_t t = rem << 32 | a[i];
+            a[i] = (uint32_t)(t / k);
+            rem = t % k;
+        }
+    }
+
+    static void add_one(Big &a)
+    {
+        for (uint32_t &d : a)
+            if (++d != 0)
+                return;
+        a.push_back(1);
+    }
+
+    // 第 i 位（从 0 起）
+    static uint32_t bit(const Big &a, size_t i) { return i / 32 < a.size() ? (a[i / 32] >> (i % 32)) & 1 : 0; }
+
+    static Big shift_right(const Big &a, size_t k)
+    {
+        size_t n = bits(a);
+        Big r(n > k ? (n - k + 31) / 32 : 1, 0);
+        for (size_t i = k; i < n; i++)
+            r[(i - k) / 32] |= bit(a, i) << ((i - k) % 32);
+        return r;
+    }
+
+    // 取 a 的最高 128 位（不足 128 位时左移补齐）
+    void set(int q, const Big &a)
+    {
+        size_t n = bits(a);
+        uint64_t h = 0, l = 0;
+        for (int i = 0; i < 128; i++)
+        {
+            uint64_t v = n >= (size_t)(128 - i) ? bit(a, n - 128 + i) : 0;
+            if (i < 64)
+                l |= v << i;
+            else
+                h |= v << (i - 64);
+        }
+        hi[q - POW5_MIN] = h;
+        lo[q - POW5_MIN] = l;
+    }
+};
+
+inline const Pow5Table &pow5_table()
+{
+    static const Pow5Table table;
+    return table;
+}
+
+// Eisel–Lemire：求 w * 10^q 最近的 double，w 非零；无法确定时返回 false
+inline bool eisel_lemire(uint64_t w, int64_t q, double &d)
+{
+    if (q < POW5_MIN)
+    {
+        d = 0; // w 至多 19 位，结果小于最小次正规数的一半
+        return true;
+    }
+    if (q > POW5_MAX)
+    {
+        d = HUGE_VAL;
+        return true;
+    }
+    const Pow5Table &t = pow5_table();
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+    unsigned __int128 first = (unsigned __int128)w * t.hi[q - POW5_MIN];
+    uint64_t hi = first >> 64, lo = (uint64_t)first;
+    const uint64_t mask = UINT64_MAX >> 55; // 乘积中决定舍入之外的低 9 位
+    if ((hi & mask) == mask)
+    {
+        // 截断误差可能进位到决定舍入的位上，再乘上低 64 位修正
+        uint64_t second = ((unsigned __int128)w * t.lo[q - POW5_MIN]) >> 64;
+        lo += second;
+        if (second > lo)
+            hi++;
+        if (lo == UINT64_MAX && (q < -27 || q > 55))
+            return false;
+    }
+    int upper = hi >> 63;
+    uint64_t mant = hi >> (upper + 9);
+    int64_t power2 = ((217706 * q) >> 16) + 63 + upper - lz + 1023; // 217706 / 2^16 ≈ log2(10)
+    if (power2 <= 0)
+        return false; // 次正规数
+    if (lo <= 1 && (mant & 3) == 1)
+        return false; // 恰在两个 double 的正中间附近，交给 strtod 按偶数舍入
+    mant += mant & 1;
+    mant >>= 1;
+    if (mant >= (2ull << 52))
+    {
+        mant = 1ull << 52;
+        power2++;
+    }
+    if (power2 >= 0x7FF)
+    {
+        d = HUGE_VAL;
+        return true;
+    }
+    uint64_t b = (mant & ~(1ull << 52)) | (uint64_t)power2 << 52;
+    memcpy(&d, &b, 8);
+    return true;
+}
+
+// s[0, n) 须完整匹配 [0-9]+(\.[0-9]+)?([eE][+-]?[0-9]+)?，给出正确舍入的 double
+inline bool parse_decimal_float(const char *s, size_t n, double &d)
+{
+    const char *p = s, *end = s + n;
+    uint64_t w = 0;
+    p = accumulate_digits(p, end, w);
+    if (p == s)
+        return false;
+    int64_t digits = p - s, q = 0;
+    if (p < end && *p == '.')
+    {
+        const char *frac = ++p;
+        p = accumulate_digits(p, end, w);
+        if (p == frac)
+            return false;
+        digits += p - frac;
+        q = -(p - frac);
+    }
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        bool neg = false;
+        if (++p < end && (*p == '+' || *p == '-'))
+            neg = *p++ == '-';
+        const char *exp = p;
+        int64_t e = 0;
+        for (; p < end && is_digit_char(*p); p++)
+            if (e < 100000)
+                e = e * 10 + (*p - '0');
+        if (p == exp)
+            return false;
+        q += neg ? -e : e;
+    }
+    if (p != end)
+        return false;
+
+    if (digits > 19)
+        for (const char *z = s; z < end && (*z == '0' || *z == '.'); z++)
+            digits -= *z == '0'; // 前导零不算有效数字
+    if (digits > 19)
+    {
+        d = strtod(string(s, n).c_str(), NULL);
+        return true;
+    }
+    if (w == 0)
+    {
+        d = 0;
+        return true;
+    }
+#if FLT_EVAL_METHOD == 0
+    // Clinger：w 与 10^|q| 都能精确表示为 double，一次乘除即是正确舍入的结果
+    static const double POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    if (w <= (1ull << 53) && q >= -22 && q <= 22)
+    {
+        d = q < 0 ? (double)w / POW10[-q] : (double)w * POW10[q];
+        return true;
+    }
+#endif
+    if (!eisel_lemire(w, q, d))
+        d = strtod(string(s, n).c_str(), NULL);
+    return true;
+}
+
+// 解码一个 C 常数（词法规则 NUM 匹配的文本）：十进制、八进制、十六进制整数与十进制浮点数，
+// 以及整数后缀 u/U、l/L、ll/LL 的组合与浮点后缀 f/F、l/L
+inline void parse_number(const char *s, size_t n, NumValue &num)
+{
+    num.type = NUM_BAD;
+    num.flags = 0;
+    num.u = 0;
+    bool hex = n > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X');
+    size_t body = n;
+    for (; body > 0; body--)
+    {
+        char c = s[body - 1];
+        if (c == 'u' || c == 'U')
+            num.flags |= NUM_UNSIGNED;
+        else if (c == 'l' || c == 'L')
+            num.flags |= num.flags & NUM_LONG ? NUM_LONG_LONG : NUM_LONG;
+        else if (!hex && (c == 'f' || c == 'F'))
+            num.flags |= NUM_FLOAT32;
+        else
+            break;
+    }
+    if (num.flags & NUM_LONG_LONG)
+        num.flags &= ~NUM_LONG;
+
+    if (hex)
+    {
+        num.flags |= NUM_HEX;
+        const char *p = s + 2, *end = s + body;
+        while (p < end && *p == '0')
+            p++;
+        if (end - p > 16)
+            return;
+        uint64_t w = 0;
+        for (; p < end; p++)
+            w = w << 4 | ((*p & 0xF) + 9 * (*p >> 6)); // '0'..'9' 为 0x3X，字母为 0x4X、0x6X，不按字符分支
+        num.type = NUM_INT;
+        num.u = w;
+        return;
+    }
+
+    // 先按整数扫一遍数字，停在 '.'、'e' 上或带 f 后缀的才是浮点数
+    uint64_t w = 0;
+    if ((num.flags & NUM_FLOAT32) || accumulate_digits(s, s + body, w) != s + body)
+    {
+        if (parse_decimal_float(s, body, num.d))
+            num.type = NUM_FLOAT;
+        return;
+    }
+    if (body > 1 && s[0] == '0')
+    {
+        num.flags |= NUM_OCTAL;
+        w = 0;
+        for (size_t i = 1; i < body; i++)
+        {
+            if (s[i] > '7' || (w >> 61) != 0)
+                return;
+            w = w << 3 | (s[i] - '0');
+        }
+        num.type = NUM_INT;
+        num.u = w;
+        return;
+    }
+    if (body <= 19)
+    {
+        num.type = NUM_INT;
+        num.u = w;
+        return;
+    }
+    if (parse_decimal_uint(s, body, num.u))
+        num.type = NUM_INT;
+}
+
+#endif
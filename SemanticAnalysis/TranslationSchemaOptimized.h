@@ -12,6 +12,10 @@
 #include <cmath>
 #include <unordered_map>
 #include <iomanip>
+#include <climits>
+#include <algorithm>
+#include "../SymbolPool.h"
+#include "../NumberLiteral.h"
 
 using namespace std;
 
@@ -60,7 +64,6 @@ enum VarType
 
 struct Symbol
 {
-    string name;
     VarType type;
     union
     {
@@ -71,52 +74,63 @@ struct Symbol
     Symbol() : type(TYPE_UNKNOWN), iVal(0) {}
 };
 
+// 变量名驻留到 SymbolPool 得到连续编号，符号直接按编号存放在数组中：
+// 每个名字只在读入时求一次哈希，之后的查询、赋值都是数组下标
 class SymbolTable
 {
 public:
-    unordered_map<string, Symbol> table;
+    SymbolPool names;
+    vector<Symbol> table; // table[id]，只被读取、从未赋值的名字 type 为 TYPE_UNKNOWN
 
-    void setInt(string name, int val)
+    uint32_t intern(string_view name)
     {
-        Symbol &sym = table[name];
-        sym.name = name;
-        sym.type = TYPE_INT;
-        sym.iVal = val;
+        uint32_t id = names.intern(name);
+        if (id >= table.size())
+            table.resize(id + 1);
+        return id;
     }
 
-    void setReal(string name, double val)
+    void setInt(uint32_t id, int val)
     {
-        Symbol &sym = table[name];
-        sym.name = name;
-        sym.type = TYPE_REAL;
-        sym.rVal = val;
+        table[id].type = TYPE_INT;
+        table[id].iVal = val;
     }
 
-    Symbol get(string name)
+    void setReal(uint32_t id, double val)
     {
-        if (table.find(name) != table.end())
-        {
-            return table[name];
-        }
-        return Symbol(); // 未知
+        table[id].type = TYPE_REAL;
+        table[id].rVal = val;
+    }
+
+    const Symbol &get(uint32_t id) const { return table[id]; }
+
+    string_view name(uint32_t id) const { return names.name(id); }
+
+    // 已赋值的变量按名字排序，以保持输出一致性
+    vector<uint32_t> sorted() const
+    {
+        vector<uint32_t> ids;
+        for (uint32_t id = 0; id < table.size(); id++)
+            if (table[id].type != TYPE_UNKNOWN)
+                ids.push_back(id);
+        sort(ids.begin(), ids.end(), [this](uint32_t a, uint32_t b) { return name(a) < name(b); });
+        return ids;
     }
 
     void dumpSnapshot(const string &filename)
     {
         ofstream out(filename);
         out << "Name,Type,Value" << endl;
-        // 排序以保持输出一致性
-        map<string, Symbol> sorted(table.begin(), table.end());
-        for (auto &pair : sorted)
+        for (uint32_t id : sorted())
         {
-            out << pair.first << ",";
-            if (pair.second.type == TYPE_INT)
+            out << name(id) << ",";
+            if (table[id].type == TYPE_INT)
             {
-                out << "int," << pair.second.iVal;
+                out << "int," << table[id].iVal;
             }
-            else if (pair.second.type == TYPE_REAL)
+            else if (table[id].type == TYPE_REAL)
             {
-                out << "real," << pair.second.rVal;
+                out << "real," << table[id].rVal;
             }
             out << endl;
         }
@@ -218,13 +232,26 @@ int read_safe(char *s)
     return len;
 }
 
+// 常数按十进制快速解码（见 NumberLiteral.h），不是完整的十进制常数时退回 atof/atoi，结果与原先一致
+double literalReal(const char *s)
+{
+    double d;
+    return parse_decimal_float(s, strlen(s), d) ? d : atof(s);
+}
+
+int literalInt(const char *s)
+{
+    uint64_t u;
+    return parse_decimal_uint(s, strlen(s), u) && u <= INT_MAX ? (int)u : atoi(s);
+}
+
 double parseValue(char *s)
 {
     if (isdigit(s[0]))
     {
-        return atof(s);
+        return literalReal(s);
     }
-    Symbol sym = symTable.get(s);
+    const Symbol &sym = symTable.get(symTable.intern(s));
     if (sym.type == TYPE_INT)
         return (double)sym.iVal;
     if (sym.type == TYPE_REAL)
@@ -252,6 +279,7 @@ void solve_opt(int line, bool execute)
     // 1. 结果变量
     int t = read_safe(s);
     result = s;
+    uint32_t rid = symTable.intern(result);
 
     read_safe(s); // =
 
@@ -273,7 +301,7 @@ void solve_opt(int line, bool execute)
         // 赋值: result = arg1
         if (execute)
         {
-            Symbol sym = symTable.get(result);
+            Symbol sym = symTable.get(rid);
             if (sym.type == TYPE_INT || sym.type == TYPE_UNKNOWN)
             {
                 // 推导
@@ -282,16 +310,16 @@ void solve_opt(int line, bool execute)
                     if (c == '.')
                         is_int = false;
                 if (is_int)
-                    symTable.setInt(result, (int)val1);
+                    symTable.setInt(rid, (int)val1);
                 else
-                    symTable.setReal(result, val1);
+                    symTable.setReal(rid, val1);
             }
             else
             {
                 if (sym.type == TYPE_INT)
-                    symTable.setInt(result, (int)val1);
+                    symTable.setInt(rid, (int)val1);
                 else
-                    symTable.setReal(result, val1);
+                    symTable.setReal(rid, val1);
             }
             irGen.emit("=", arg1, "", result);
         }
@@ -325,11 +353,11 @@ void solve_opt(int line, bool execute)
                 }
             }
 
-            Symbol sym = symTable.get(result);
+            Symbol sym = symTable.get(rid);
             if (sym.type == TYPE_INT)
-                symTable.setInt(result, (int)res);
+                symTable.setInt(rid, (int)res);
             else
-                symTable.setReal(result, res);
+                symTable.setReal(rid, res);
 
             irGen.emit(op, arg1, arg2, result);
         }
@@ -357,6 +385,7 @@ void solve_opt_wrapper(int line, bool execute)
     // 结果
     int t = read_token_wrapper(s);
     result = s;
+    uint32_t rid = symTable.intern(result);
 
     read_token_wrapper(s); // =
 
@@ -403,11 +432,11 @@ void solve_opt_wrapper(int line, bool execute)
                         res = val1 / val2;
                 }
 
-                Symbol sym = symTable.get(result);
+                Symbol sym = symTable.get(rid);
                 if (sym.type == TYPE_INT)
-                    symTable.setInt(result, (int)res);
+                    symTable.setInt(rid, (int)res);
                 else
-                    symTable.setReal(result, res);
+                    symTable.setReal(rid, res);
 
                 irGen.emit(op, arg1, arg2, result);
             }
@@ -418,7 +447,7 @@ void solve_opt_wrapper(int line, bool execute)
     // 仅赋值情况
     if (execute)
     {
-        Symbol sym = symTable.get(result);
+        Symbol sym = symTable.get(rid);
         if (sym.type == TYPE_INT || sym.type == TYPE_UNKNOWN)
         {
             bool is_int = true;
@@ -426,16 +455,16 @@ void solve_opt_wrapper(int line, bool execute)
                 if (c == '.')
                     is_int = false;
             if (is_int)
-                symTable.setInt(result, (int)val1);
+                symTable.setInt(rid, (int)val1);
             else
-                symTable.setReal(result, val1);
+                symTable.setReal(rid, val1);
         }
         else
         {
             if (sym.type == TYPE_INT)
-                symTable.setInt(result, (int)val1);
+                symTable.setInt(rid, (int)val1);
             else
-                symTable.setReal(result, val1);
+                symTable.setReal(rid, val1);
         }
         irGen.emit("=", arg1, "", result);
     }
@@ -514,8 +543,8 @@ void AnalysisOptimized(istream &in, const string &baseName)
             string name = s;
             read_token_wrapper(s); // =
             read_token_wrapper(s); // val
-            int val = atoi(s);
-            symTable.setInt(name, val);
+            int val = literalInt(s);
+            symTable.setInt(symTable.intern(name), val);
             irGen.emit("DECL_INT", s, "", name);
         }
         else if (strcmp(s, "real") == 0)
@@ -524,8 +553,8 @@ void AnalysisOptimized(istream &in, const string &baseName)
             string name = s;
             read_token_wrapper(s); // =
             read_token_wrapper(s); // val
-            double val = atof(s);
-            symTable.setReal(name, val);
+            double val = literalReal(s);
+            symTable.setReal(symTable.intern(name), val);
             irGen.emit("DECL_REAL", s, "", name);
         }
         else
@@ -569,17 +598,14 @@ void AnalysisOptimized(istream &in, const string &baseName)
     // 输出
     if (flag_err)
     {
-        map<string, Symbol> sorted(symTable.table.begin(), symTable.table.end());
-        for (auto &pair : sorted)
+        for (uint32_t id : symTable.sorted())
         {
-            if (pair.second.type != TYPE_UNKNOWN)
-            {
-                cout << pair.first << ": ";
-                if (pair.second.type == TYPE_INT)
-                    cout << pair.second.iVal << endl;
-                else
-                    cout << pair.second.rVal << endl;
-            }
+            const Symbol &sym = symTable.get(id);
+            cout << symTable.name(id) << ": ";
+            if (sym.type == TYPE_INT)
+                cout << sym.iVal << endl;
+            else
+                cout << sym.rVal << endl;
         }
     }
 
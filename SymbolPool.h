@@ -0,0 +1,154 @@
+#ifndef SYMBOL_POOL_H
+#define SYMBOL_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+// 标识符驻留池：同名标识符只存一份，并分配从 0 开始的连续 32 位编号
+// 名字拷贝进按块分配的内存区，永不移动，name() 返回的视图在池存续期间一直有效；
+// 编号到名字是数组下标，名字到编号是开放定址（线性探测）的哈希表
+// 之后的比较、符号表查找都可以直接用编号，不再对字符串重复求哈希
+
+const uint32_t SYM_NONE = UINT32_MAX; // 非标识符记号或未启用驻留
+
+class SymbolPool
+{
+public:
+    SymbolPool() : cur(NULL), left(0), cap(0) { rehash(64); }
+
+    // 返回 name 的编号，第一次出现时分配新编号
+    uint32_t intern(string_view name)
+    {
+        uint32_t h = hash(name);
+        size_t mask = slots.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask)
+        {
+            uint64_t s = slots[i];
+            if (s == 0)
+            {
+                uint32_t id = names.size();
+                names.push_back(store(name));
+                slots[i] = (uint64_t)h << 32 | (id + 1);
+                if (names.size() * 2 > slots.size())
+                    rehash(slots.size() * 2); // 装载因子不超过 1/2
+                return id;
+            }
+            if ((uint32_t)(s >> 32) == h && names[(uint32_t)s - 1] == name)
+                return (uint32_t)s - 1;
+        }
+    }
+
+    // 只查找，不存在时返回 SYM_NONE
+    uint32_t find(string_view name) const
+    {
+        uint32_t h = hash(name);
+        size_t mask = slots.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask)
+        {
+            uint64_t s = slots[i];
+            if (s == 0)
+                return SYM_NONE;
+            if ((uint32_t)(s >> 32) == h && names[(uint32_t)s - 1] == name)
+                return (uint32_t)s - 1;
+        }
+    }
+
+    // 名字以 '\0' 结尾，name(id).data() 可直接当 C 字符串使用
+    string_view name(uint32_t id) const { return names[id]; }
+
+    size_t size() const { return names.size(); }
+
+    // 名字占用的内存区字节数（含每个名字后的 '\0'）
+    size_t arena_bytes() const { return cap; }
+
+private:
+    static const size_t BLOCK = 64 << 10;
+
+    vector<unique_ptr<char[]>> blocks;
+    char *cur;   // 当前块中的空闲处
+    size_t left; // 当前块剩余字节数
+    size_t cap;  // 各块字节数之和
+    vector<string_view> names; // 编号 -> 名字
+    // 哈希表：高 32 位为哈希值，低 32 位为编号 + 1，0 表示空位；探测时先比哈希值，
+    // 不必为此访问 names 与名字本身，扩容时也不必重算哈希
+    vector<uint64_t> slots;
+
+    // 每次取 8 字节与一个奇数相乘混合，标识符一般只需一两轮
+    static uint32_t hash(string_view s)
+    {
+        const uint64_t K = 0x9E3779B97F4A7C15ull;
+        uint64_t h = s.size() * K;
+        size_t i = 0;
+        for (; i + 8 <= s.size(); i += 8)
+        {
+            uint64_t w;
+            memcpy(&w, s.data() + i, 8);
+            h = (h ^ w) * K;
+            h ^= h >> 29;
+        }
+        if (i < s.size())
+        {
+            uint64_t w = 0;
+            memcpy(&w, s.data() + i, s.size() - i);
+            h = (h ^ w) * K;
+        }
+        // 乘法只把低位扩散到高位，名字末尾的字符落在高位；再折回低位混合一次，表下标取低位才分布均匀
+        h ^= h >> 32;
+        h *= K;
+        h ^= h >> 29;
+        return (uint32_t)h;
+    }
+
+    string_view store(string_view s)
+    {
+        size_t need = s.size() + 1;
+        char *p;
+        if (need > BLOCK)
+            p = allocate(need); // 超长的名字单独占一块，当前块照常接着使用
+        else
+        {
+            if (need > left)
+            {
+                cur = allocate(BLOCK);
+                left = BLOCK;
+            }
+            p = cur;
+            cur += need;
+            left -= need;
+        }
+        memcpy(p, s.data(), s.size());
+        p[s.size()] = '\0';
+        return string_view(p, s.size());
+    }
+
+    char *allocate(size_t size)
+    {
+        blocks.push_back(unique_ptr<char[]>(new char[size]));
+        cap += size;
+        return blocks.back().get();
+    }
+
+    void rehash(size_t count)
+    {
+        vector<uint64_t> old(count, 0);
+        old.swap(slots);
+        size_t mask = count - 1;
+        for (uint64_t s : old)
+        {
+            if (s == 0)
+                continue;
+            size_t i = (s >> 32) & mask;
+            while (slots[i] != 0)
+                i = (i + 1) & mask;
+            slots[i] = s;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,9 @@
+int main() {
+    int dec = 123 + 0 + 4294967295u;
+    unsigned long hex = 0x1F + 0XABCDEFu + 0xffffffffffffffffULL;
+    int oct = 017 + 0777L;
+    long long big = 42ll + 9223372036854775807LL + 100Lu;
+    float f = 1.5f + 0.5 + 1e10 + 1E-5 + 2.5e+3F;
+    double d = 3.14159265358979 + 0.1L + 6.02e23;
+    return dec - 1;
+}
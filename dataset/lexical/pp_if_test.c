@@ -0,0 +1,33 @@
+/* #if 按寻常算术转换区分有符号与无符号，&&、||、?: 不求值的一侧不报错 */
+#if (0u - 1) > 0
+int unsigned_wraps;
+#endif
+#if 0xFFFFFFFFFFFFFFFF > 0
+int large_hex_is_unsigned;
+#endif
+#if -1 < 0u
+int wrong;
+#else
+int minus_one_converted;
+#endif
+#if -1 < 0
+int signed_compare;
+#endif
+#if (-1 >> 1) < 0 && (0u - 1) >> 63 == 1
+int shift_keeps_left_type;
+#endif
+#if defined FOO && 100 / FOO > 1
+int wrong2;
+#else
+int and_short_circuit;
+#endif
+#define FOO 0
+#if FOO == 0 || 1 / FOO
+int or_short_circuit;
+#endif
+#if FOO ? 1 / FOO : 1 % 1 == 0
+int cond_short_circuit;
+#endif
+#if (1 ? -1 : 0u) > 0
+int cond_unsigned;
+#endif
@@ -0,0 +1,8 @@
+int a = __LINE__;
+#line 100
+int b = __LINE__;
+#define FILE_NAME "renamed.c"
+#line 200 FILE_NAME
+char *f = __FILE__; int c = __LINE__;
+#line x
+#warning after line
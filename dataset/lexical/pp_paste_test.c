@@ -0,0 +1,9 @@
+#define paste(a, b) a ## b
+#define str(x) #x
+/* 粘接出预处理数 */
+double d = paste(., 5) + paste(1e, +3) + paste(0x, 1F);
+/* 字符串化时字符串、字符常量中的 '"' 与 '\' 加上转义 */
+char *s = str("\\") str('"') str("a\n" 'b');
+/* 重复的形参 */
+#define twice(a, a) a
+int x = 1;
@@ -0,0 +1,17 @@
+#define STR(x) #x
+/* 以续行开头的字符串，同 glibc pthread.h 中的 __attribute_deprecated_msg__ ("\ */
+a("\
+xy");
+#if 0
+b("\
+skipped");
+#else
+c("z");
+#endif
+#define LONG_MACRO(a, b) \
+    ((a) + \
+     (b))
+int x = LONG_MACRO(1, 2);
+char *s = STR("\\") "\n" STR('\'');
+char q = '"';
+int line = __LINE__;
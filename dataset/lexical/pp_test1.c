@@ -0,0 +1,20 @@
+#define N 10
+#define SQUARE(x) ((x) * (x))
+#define CAT(a, b) a##b
+#define STR(x) #x
+#define DEBUG 1
+
+int main() {
+    int CAT(var, 1) = SQUARE(N + 1);
+#if DEBUG && N > 5
+    char *s = STR(N + 1);
+#elif defined(RELEASE)
+    char *s = "release";
+#else
+    char *s = "";
+#endif
+#ifdef RELEASE
+    return 1;
+#endif
+    return __LINE__;
+}
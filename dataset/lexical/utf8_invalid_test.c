@@ -0,0 +1,3 @@
+int ok = 1;
+int bad = 2; char *t = "(";
+int after = ok;
@@ -0,0 +1,3 @@
+int 变量 = 1;
+char *s = "héllo";
+/* 注释 */ int naïve_count = 变量 + 2;
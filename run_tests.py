@@ -9,27 +9,31 @@ PROJECTS = {
         "src": "LexicalAnalysis/main.cpp",
         "include": "LexicalAnalysis",
         "exe": "LexicalAnalysis/output/main.exe",
-        "test_dir": "dataset/lexical"
+        "test_dir": "dataset/lexical",
+        "flags": ["-std=c++17", "-O2", "-pthread"]
     },
     "ll": {
         "src": "LLparser/LLparserMain.cpp",
         "include": "LLparser",
         "exe": "LLparser/output/LLparser.exe",
         "test_dir": "dataset/parser/ll",
-        "dot_file": "ll_tree.dot"
+        "dot_file": "ll_tree.dot",
+        "flags": ["-std=c++17"]
     },
     "lr": {
         "src": "LRparser/LRparserMain.cpp",
         "include": "LRparser",
         "exe": "LRparser/output/LRparser.exe",
         "test_dir": "dataset/parser/lr",
-        "dot_file": "lr_tree.dot"
+        "dot_file": "lr_tree.dot",
+        "flags": ["-std=c++17"]
     },
     "semantic": {
         "src": "SemanticAnalysis/TranslationSchema.cpp",
         "include": "SemanticAnalysis",
         "exe": "SemanticAnalysis/main.exe",
-        "test_dir": "dataset/semantic"
+        "test_dir": "dataset/semantic",
+        "flags": ["-std=c++17"]
     }
 }
 
@@ -40,7 +44,7 @@ def compile_project(name, config):
         os.makedirs(output_dir)
     
     # 处理 Windows 路径以及可能存在的空格/编码问题
-    cmd = ["g++", config["src"], "-I", config["include"], "-o", config["exe"]]
+    cmd = ["g++", config["src"], "-I", config["include"], "-o", config["exe"]] + config.get("flags", [])
     
     try:
         # 优先使用 GBK 解析 Windows 编译输出
@@ -93,8 +97,12 @@ def run_tests(name, config):
             if "dot_file" in config and os.path.exists(config["dot_file"]):
                 os.remove(config["dot_file"])
 
-            # 运行可执行文件，将输入文件作为参数传入
-            result = subprocess.run([exe_path, filepath], capture_output=True, text=True, timeout=5, encoding='utf-8', errors='ignore')
+            # 运行可执行文件，将输入文件作为参数传入；传相对路径，输出中的文件名与项目所在位置无关
+            # 词法分析中以 pp_ 开头的用例先预处理（--pp）
+            cmd = [exe_path]
+            if name == "lexical" and filename.startswith("pp_"):
+                cmd.append("--pp")
+            result = subprocess.run(cmd + [os.path.relpath(filepath)], capture_output=True, text=True, timeout=5, encoding='utf-8', errors='ignore')
             
             print(f"    返回码: {result.returncode}")
             